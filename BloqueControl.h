@@ -0,0 +1,515 @@
+#ifndef BLOQUECONTROL_H
+#define BLOQUECONTROL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include "ArenaBloques.h"
+#include "Guarderia.h"
+#include "MPointerGC.h"
+#include "PoliticasMPointer.h"
+
+template <typename T, typename Politica = PoliticaPorDefecto>
+class MPointer;
+
+struct BloqueControl;
+
+// Visitante que el Garbage Collector pasa al recorrer las referencias de un objeto
+// Qué sucede: Recibe cada MPointer contenido en un objeto y entrega su bloque al GC.
+// Por qué sucede: El GC solo conoce bloques; el visitante traduce los MPointer de cualquier tipo.
+// Qué deberíamos esperar: Los MPointer nulos se ignoran.
+class VisitanteGC {
+private:
+    void (*funcion)(BloqueControl*, void*);
+    void* contexto;
+
+public:
+    VisitanteGC(void (*funcion)(BloqueControl*, void*), void* contexto) : funcion(funcion), contexto(contexto) {}
+
+    void visitar(BloqueControl* hijo) const {
+        if (hijo != nullptr) {
+            funcion(hijo, contexto);
+        }
+    }
+
+    template <typename U, typename Politica>
+    void operator()(const MPointer<U, Politica>& referencia) const;  // Definido en MPointer.h
+};
+
+// Describe qué MPointer contiene un tipo, para que el GC pueda detectar ciclos
+// Qué sucede: Por defecto un tipo no contiene referencias y nunca forma parte de un ciclo.
+// Por qué sucede: Los tipos que guardan MPointer (como Nodo) especializan esta plantilla.
+// Qué deberíamos esperar: `trazar` llama al visitante una vez por cada MPointer del objeto.
+template <typename T>
+struct TrazadoMPointer {
+    static constexpr bool tieneReferencias = false;
+
+    static void trazar(const T&, const VisitanteGC&) {}
+};
+
+// Operaciones que dependen del tipo del objeto, compartidas por todos los bloques de ese tipo
+struct OperacionesBloque {
+    void (*destruirObjeto)(BloqueControl*);  // Ejecuta el destructor del objeto
+    void (*liberarMemoria)(BloqueControl*);  // Libera la memoria del bloque (y del objeto, si es aparte)
+    void (*trazar)(BloqueControl*, const VisitanteGC&);  // Visita las referencias del objeto, o nullptr si no tiene
+    std::size_t bytes;  // Memoria total que ocupa un objeto con su bloque
+    const std::type_info* tipo;  // Tipo del objeto, para el perfil del heap
+    bool bloqueEnObjeto;  // El bloque es parte del objeto (intrusivo) y muere con él: no admite referencias débiles
+};
+
+// Metadatos compartidos por todas las copias de un MPointer
+// Los contadores son siempre std::atomic para que el GC los lea igual en ambos modos. Con una política
+// no atómica se actualizan con cargas y escrituras simples (sin instrucciones bloqueantes), lo que solo
+// es válido si cada objeto se comparte dentro de un único hilo.
+// Como en std::shared_ptr, las referencias fuertes destruyen el objeto y las débiles (MWeakPointer)
+// solo mantienen el bloque: `debiles` cuenta una más mientras quede alguna fuerte, así que el último
+// en soltar, fuerte o débil, es el único que libera la memoria.
+struct BloqueControl {
+    std::atomic<int> refCount;  // Contador de referencias compartidas
+    int gcRefs;  // Referencias externas estimadas durante una recolección
+    MPointerGC::Handle id;  // Handle del objeto en el Garbage Collector
+    const OperacionesBloque* ops;  // Operaciones del tipo del objeto
+    std::uint8_t marca;  // Estado del bloque durante una recolección; fuera de ella, 0 o la vuelta que lo analizó
+    std::atomic<int> debiles;  // Referencias débiles, más una mientras el objeto viva (ocupa el relleno final)
+
+    // Contador de un objeto que el GC está liberando como basura: tan negativo que los decrementos de
+    // los destructores del ciclo nunca lo llevan a 0, y ninguna referencia débil lo puede recuperar.
+    static constexpr int RECOLECTADO = std::numeric_limits<int>::min() / 2;
+
+    // Suma una referencia. Un incremento no publica datos, así que basta el orden relajado.
+    template <bool Atomico = CONTADOR_ATOMICO_POR_DEFECTO>
+    void retener() noexcept {
+        if (Atomico) {
+            refCount.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            refCount.store(refCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    // Resta una referencia; devuelve true si era la última.
+    // El decremento final adquiere las escrituras de los demás hilos antes de destruir el objeto.
+    template <bool Atomico = CONTADOR_ATOMICO_POR_DEFECTO>
+    bool soltarReferencia() noexcept {
+        if (Atomico) {
+            if (refCount.fetch_sub(1, std::memory_order_release) == 1) {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return true;
+            }
+            return false;
+        }
+        int restantes = refCount.load(std::memory_order_relaxed) - 1;
+        refCount.store(restantes, std::memory_order_relaxed);
+        return restantes == 0;
+    }
+
+    // Cantidad actual de referencias (0 o menos si el objeto ya se destruyó)
+    int referencias() const noexcept {
+        return refCount.load(std::memory_order_relaxed);
+    }
+
+    // Suma una referencia fuerte solo si el objeto sigue vivo; devuelve si lo logró (MWeakPointer::lock)
+    // Con atomicidad es un compare-exchange, para no revivir un objeto que otro hilo está soltando.
+    template <bool Atomico = CONTADOR_ATOMICO_POR_DEFECTO>
+    bool retenerSiVive() noexcept {
+        int actuales = refCount.load(std::memory_order_relaxed);
+        if (Atomico) {
+            while (actuales > 0) {
+                if (refCount.compare_exchange_weak(actuales, actuales + 1, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        if (actuales <= 0) {
+            return false;
+        }
+        refCount.store(actuales + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Suma una referencia débil
+    template <bool Atomico = CONTADOR_ATOMICO_POR_DEFECTO>
+    void retenerDebil() noexcept {
+        if (Atomico) {
+            debiles.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            debiles.store(debiles.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    // Resta una referencia débil; devuelve true si era la última y hay que liberar la memoria
+    template <bool Atomico = CONTADOR_ATOMICO_POR_DEFECTO>
+    bool soltarDebil() noexcept {
+        if (Atomico) {
+            return debiles.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+        int restantes = debiles.load(std::memory_order_relaxed) - 1;
+        debiles.store(restantes, std::memory_order_relaxed);
+        return restantes == 0;
+    }
+
+    // Fija el contador de un objeto que el GC va a liberar (ver RECOLECTADO)
+    void marcarRecolectado() noexcept {
+        refCount.store(RECOLECTADO, std::memory_order_relaxed);
+    }
+
+    // Destruye el objeto y libera el bloque, salvo que lo retenga alguna referencia débil
+    // Las operaciones se leen antes: en un objeto intrusivo, el bloque se destruye junto con el objeto.
+    template <bool Atomico = CONTADOR_ATOMICO_POR_DEFECTO>
+    void destruir() {
+        const OperacionesBloque* operaciones = ops;
+        operaciones->destruirObjeto(this);
+        if (operaciones->bloqueEnObjeto || soltarDebil<Atomico>()) {
+            operaciones->liberarMemoria(this);
+        }
+    }
+
+protected:
+    // Deja el bloque listo con una referencia y sin registrar
+    void inicializar(const OperacionesBloque* operaciones) {
+        refCount.store(1, std::memory_order_relaxed);
+        gcRefs = 0;
+        id = MPointerGC::HANDLE_INVALIDO;
+        ops = operaciones;
+        marca = 0;
+        debiles.store(1, std::memory_order_relaxed);
+    }
+};
+
+// Bloque que aloja el objeto en la misma reserva que sus metadatos
+// Qué sucede: El contador, el handle y el objeto de tipo T viven contiguos en memoria.
+// Por qué sucede: Una sola reserva por objeto en lugar de tres, y el contador queda junto a los datos.
+// Qué deberíamos esperar: `crear` hace una sola reserva, en la arena por defecto de T, en la arena
+// indicada o, con nullptr, con `new`; `crearJoven`, en la guardería del hilo. `liberarMemoria` la
+// devuelve al mismo lugar.
+template <typename T>
+struct BloqueEnLinea : BloqueControl {
+    // De dónde viene la memoria del bloque
+    enum class Origen : std::uint8_t { Heap, Arena, Guarderia };
+
+    Origen origen;
+    alignas(T) unsigned char almacen[sizeof(T)];  // Espacio para el objeto, construido en el lugar
+
+    static const OperacionesBloque operaciones;
+
+    // Un bloque que entra en la guardería puede nacer joven (MPointerGC::setGenerationalMode)
+    static constexpr bool EN_GUARDERIA = Guarderia::admite(sizeof(BloqueEnLinea), alignof(BloqueEnLinea));
+
+    // Arena compartida por todos los bloques de tipo T. No se destruye nunca, para que los
+    // objetos que sigan vivos al terminar el programa (o el hilo del GC) no la usen ya destruida.
+    static ArenaBloques* arenaPorDefecto() {
+        if (!ArenaBloques::admite(sizeof(BloqueEnLinea), alignof(BloqueEnLinea))) {
+            return nullptr;
+        }
+        static ArenaBloques* arena = new ArenaBloques(sizeof(BloqueEnLinea), alignof(BloqueEnLinea));
+        return arena;
+    }
+
+    T* objeto() {
+        return std::launder(reinterpret_cast<T*>(almacen));
+    }
+
+    template <typename... Args>
+    static BloqueEnLinea* crear(Args&&... args) {
+        return crearEn(arenaPorDefecto(), std::forward<Args>(args)...);
+    }
+
+    // Una arena que no admite este tamaño se ignora y se usa `new`
+    template <typename... Args>
+    static BloqueEnLinea* crearEn(ArenaBloques* arena, Args&&... args) {
+        if (arena != nullptr && !arena->sirvePara(sizeof(BloqueEnLinea), alignof(BloqueEnLinea))) {
+            arena = nullptr;
+        }
+        BloqueEnLinea* bloque = arena != nullptr ? ::new (arena->reservar()) BloqueEnLinea : new BloqueEnLinea;
+        bloque->origen = arena != nullptr ? Origen::Arena : Origen::Heap;
+        try {
+            ::new (static_cast<void*>(bloque->almacen)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            liberarMemoria(bloque);
+            throw;
+        }
+        bloque->inicializar(&operaciones);
+        return bloque;
+    }
+
+    // Crea el bloque en la guardería del hilo, sin registrar; requiere EN_GUARDERIA
+    // Mientras el objeto se construye, su contador vale 0 y el GC saltea el espacio al recorrer los
+    // trozos. Si la construcción falla, el espacio queda así, liberado, hasta que se reutilice el trozo.
+    template <typename... Args>
+    static BloqueEnLinea* crearJoven(Args&&... args) {
+        void* espacio = Guarderia::reservar(Guarderia::redondear(sizeof(BloqueEnLinea)), [](void* memoria) {
+            BloqueEnLinea* nuevo = ::new (memoria) BloqueEnLinea;
+            nuevo->inicializar(&operaciones);
+            nuevo->refCount.store(0, std::memory_order_relaxed);
+            nuevo->origen = Origen::Guarderia;
+        });
+        BloqueEnLinea* bloque = static_cast<BloqueEnLinea*>(espacio);
+        try {
+            ::new (static_cast<void*>(bloque->almacen)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            Guarderia::liberar(bloque);
+            throw;
+        }
+        bloque->refCount.store(1, std::memory_order_relaxed);
+        return bloque;
+    }
+
+    // Crea `cantidad` bloques, construyendo cada objeto a partir de un elemento desde `primero`,
+    // y los agrega a `bloques`. La memoria de la arena se toma con una sola reserva en lote.
+    // Si una construcción falla, se destruye lo creado en esta llamada y se relanza la excepción.
+    template <typename Iterador>
+    static void crearLoteEn(ArenaBloques* arena, Iterador primero, std::size_t cantidad, std::vector<BloqueControl*>& bloques) {
+        if (arena != nullptr && !arena->sirvePara(sizeof(BloqueEnLinea), alignof(BloqueEnLinea))) {
+            arena = nullptr;
+        }
+        const std::size_t inicio = bloques.size();
+        bloques.reserve(inicio + cantidad);
+        std::vector<void*> memoria(arena != nullptr ? cantidad : 0);
+        if (arena != nullptr) {
+            arena->reservarLote(cantidad, memoria.data());
+        }
+        std::size_t i = 0;
+        try {
+            for (; i < cantidad; i++, ++primero) {
+                BloqueEnLinea* bloque = arena != nullptr ? ::new (memoria[i]) BloqueEnLinea : new BloqueEnLinea;
+                bloque->origen = arena != nullptr ? Origen::Arena : Origen::Heap;
+                try {
+                    ::new (static_cast<void*>(bloque->almacen)) T(*primero);
+                } catch (...) {
+                    liberarMemoria(bloque);
+                    throw;
+                }
+                bloque->inicializar(&operaciones);
+                bloques.push_back(bloque);
+            }
+        } catch (...) {
+            for (std::size_t j = i + 1; j < memoria.size(); j++) {
+                ArenaBloques::liberar(memoria[j]);
+            }
+            for (std::size_t j = inicio; j < bloques.size(); j++) {
+                bloques[j]->destruir();
+            }
+            bloques.resize(inicio);
+            throw;
+        }
+    }
+
+    static void destruirObjeto(BloqueControl* control) {
+        static_cast<BloqueEnLinea*>(control)->objeto()->~T();
+    }
+
+    static void liberarMemoria(BloqueControl* control) {
+        BloqueEnLinea* bloque = static_cast<BloqueEnLinea*>(control);
+        switch (bloque->origen) {
+        case Origen::Arena:
+            bloque->~BloqueEnLinea();
+            ArenaBloques::liberar(bloque);
+            break;
+        case Origen::Guarderia:
+            Guarderia::liberar(bloque);  // El espacio conserva la cabecera para el recorrido del GC.
+            break;
+        default:
+            delete bloque;
+        }
+    }
+
+    static void trazarObjeto(BloqueControl* control, const VisitanteGC& visitante) {
+        TrazadoMPointer<T>::trazar(*static_cast<BloqueEnLinea*>(control)->objeto(), visitante);
+    }
+};
+
+// Arena propia para bloques de tipo T, para separar la memoria de una estructura del resto
+// (por ejemplo, una lista cuyos nodos se quieren juntos y lejos de los de otras listas).
+template <typename T>
+class ArenaDe : public ArenaBloques {
+public:
+    ArenaDe() : ArenaBloques(sizeof(BloqueEnLinea<T>), alignof(BloqueEnLinea<T>)) {}
+};
+
+template <typename T>
+const OperacionesBloque BloqueEnLinea<T>::operaciones = {
+    &BloqueEnLinea<T>::destruirObjeto,
+    &BloqueEnLinea<T>::liberarMemoria,
+    TrazadoMPointer<T>::tieneReferencias ? &BloqueEnLinea<T>::trazarObjeto : nullptr,
+    sizeof(BloqueEnLinea<T>),
+    &typeid(T),
+    false,
+};
+
+// Bloque para un objeto que ya fue reservado por separado (por ejemplo con `new T`)
+template <typename T>
+struct BloqueExterno : BloqueControl {
+    T* ptr;  // Objeto adoptado, que se libera con `delete`
+
+    static const OperacionesBloque operaciones;
+
+    static BloqueExterno* crear(T* crudo) {
+        BloqueExterno* bloque;
+        try {
+            bloque = new BloqueExterno;
+        } catch (...) {
+            delete crudo;
+            throw;
+        }
+        bloque->ptr = crudo;
+        bloque->inicializar(&operaciones);
+        return bloque;
+    }
+
+    static void destruirObjeto(BloqueControl* control) {
+        BloqueExterno* bloque = static_cast<BloqueExterno*>(control);
+        delete bloque->ptr;
+        bloque->ptr = nullptr;
+    }
+
+    static void liberarMemoria(BloqueControl* control) {
+        delete static_cast<BloqueExterno*>(control);
+    }
+
+    static void trazarObjeto(BloqueControl* control, const VisitanteGC& visitante) {
+        TrazadoMPointer<T>::trazar(*static_cast<BloqueExterno*>(control)->ptr, visitante);
+    }
+};
+
+template <typename T>
+const OperacionesBloque BloqueExterno<T>::operaciones = {
+    &BloqueExterno<T>::destruirObjeto,
+    &BloqueExterno<T>::liberarMemoria,
+    TrazadoMPointer<T>::tieneReferencias ? &BloqueExterno<T>::trazarObjeto : nullptr,
+    sizeof(BloqueExterno<T>) + sizeof(T),
+    &typeid(T),
+    false,
+};
+
+// Base de los objetos que guardan su propio contador (política intrusiva)
+// Qué sucede: El objeto hereda el bloque de control, así que objeto y metadatos son la misma reserva
+// y un MPointer intrusivo guarda un solo puntero.
+// Por qué sucede: En estructuras con muchos enlaces, como Nodo, cada enlace ocupa la mitad.
+// Qué deberíamos esperar: Copiar un objeto intrusivo copia sus datos, nunca su contador ni su handle.
+class ObjetoIntrusivo : public BloqueControl {
+protected:
+    ObjetoIntrusivo() {}
+    ObjetoIntrusivo(const ObjetoIntrusivo&) : BloqueControl() {}
+
+    ObjetoIntrusivo& operator=(const ObjetoIntrusivo&) {
+        return *this;
+    }
+
+    template <typename T>
+    friend struct BloqueIntrusivo;
+};
+
+// Base vacía de los objetos cuyo contador vive en un bloque aparte
+struct ObjetoConBloqueExterno {};
+
+// Base que necesita un objeto para ser apuntado con `Politica`: ObjetoIntrusivo o una base vacía
+template <typename Politica>
+using BaseSegunPolitica = std::conditional_t<Politica::intrusivo, ObjetoIntrusivo, ObjetoConBloqueExterno>;
+
+// Creación y operaciones de un objeto intrusivo de tipo T
+// Qué sucede: Reserva T en la arena por defecto de su tamaño (o con `new` si no entra en una losa).
+// Por qué sucede: La decisión depende solo de sizeof(T), así que no hace falta guardarla en el objeto.
+// Qué deberíamos esperar: Una sola reserva por objeto, igual que BloqueEnLinea, sin el puntero extra.
+template <typename T>
+struct BloqueIntrusivo {
+    static constexpr bool EN_ARENA = ArenaBloques::admite(sizeof(T), alignof(T));
+
+    static const OperacionesBloque operaciones;
+
+    // Arena compartida por todos los objetos intrusivos de tipo T; no se destruye nunca
+    static ArenaBloques* arena() {
+        static ArenaBloques* arena = new ArenaBloques(sizeof(T), alignof(T));
+        return arena;
+    }
+
+    static T* objetoDe(BloqueControl* control) {
+        return static_cast<T*>(static_cast<ObjetoIntrusivo*>(control));
+    }
+
+    template <typename... Args>
+    static T* crear(Args&&... args) {
+        void* memoria = EN_ARENA ? arena()->reservar() : ::operator new(sizeof(T));
+        T* objeto;
+        try {
+            objeto = ::new (memoria) T(std::forward<Args>(args)...);
+        } catch (...) {
+            liberar(memoria);
+            throw;
+        }
+        static_cast<ObjetoIntrusivo*>(objeto)->inicializar(&operaciones);
+        return objeto;
+    }
+
+    // Igual que BloqueEnLinea::crearLoteEn, en la arena del tipo
+    template <typename Iterador>
+    static void crearLote(Iterador primero, std::size_t cantidad, std::vector<BloqueControl*>& bloques) {
+        const std::size_t inicio = bloques.size();
+        bloques.reserve(inicio + cantidad);
+        std::vector<void*> memoria(EN_ARENA ? cantidad : 0);
+        if (EN_ARENA) {
+            arena()->reservarLote(cantidad, memoria.data());
+        }
+        std::size_t i = 0;
+        try {
+            for (; i < cantidad; i++, ++primero) {
+                void* lugar = EN_ARENA ? memoria[i] : ::operator new(sizeof(T));
+                T* objeto;
+                try {
+                    objeto = ::new (lugar) T(*primero);
+                } catch (...) {
+                    liberar(lugar);
+                    throw;
+                }
+                static_cast<ObjetoIntrusivo*>(objeto)->inicializar(&operaciones);
+                bloques.push_back(static_cast<ObjetoIntrusivo*>(objeto));
+            }
+        } catch (...) {
+            for (std::size_t j = i + 1; j < memoria.size(); j++) {
+                liberar(memoria[j]);
+            }
+            for (std::size_t j = inicio; j < bloques.size(); j++) {
+                bloques[j]->destruir();
+            }
+            bloques.resize(inicio);
+            throw;
+        }
+    }
+
+    static void liberar(void* memoria) {
+        if (EN_ARENA) {
+            ArenaBloques::liberar(memoria);
+        } else {
+            ::operator delete(memoria);
+        }
+    }
+
+    static void destruirObjeto(BloqueControl* control) {
+        objetoDe(control)->~T();
+    }
+
+    static void liberarMemoria(BloqueControl* control) {
+        liberar(objetoDe(control));
+    }
+
+    static void trazarObjeto(BloqueControl* control, const VisitanteGC& visitante) {
+        TrazadoMPointer<T>::trazar(*objetoDe(control), visitante);
+    }
+};
+
+template <typename T>
+const OperacionesBloque BloqueIntrusivo<T>::operaciones = {
+    &BloqueIntrusivo<T>::destruirObjeto,
+    &BloqueIntrusivo<T>::liberarMemoria,
+    TrazadoMPointer<T>::tieneReferencias ? &BloqueIntrusivo<T>::trazarObjeto : nullptr,
+    sizeof(T),
+    &typeid(T),
+    true,
+};
+
+#endif
@@ -0,0 +1,90 @@
+#include "Guarderia.h"
+#include <new>
+#include "MPointerGC.h"
+
+std::mutex Guarderia::mutexLibres;
+Guarderia::Trozo* Guarderia::libres = nullptr;
+
+// El hilo que termina suelta su trozo; sus objetos vivos lo siguen reteniendo
+Guarderia::DuenoTrozo::~DuenoTrozo() {
+    if (cursorDelHilo.trozo != nullptr) {
+        retirar(cursorDelHilo);
+    }
+}
+
+// Método para soltar la retención del hilo sobre su trozo
+// Lo que queda en `vivos` son los espacios todavía tomados; si no queda ninguno, el trozo vuelve a la reserva.
+void Guarderia::retirar(Cursor& cursor) {
+    std::int64_t retencion = RETENCION - cursor.reservados;
+    if (cursor.trozo->vivos.fetch_sub(retencion, std::memory_order_acq_rel) == retencion) {
+        devolver(cursor.trozo);
+    }
+    cursor = Cursor{nullptr, nullptr, nullptr, 0};
+}
+
+// Método para devolver un trozo vacío a la reserva común
+void Guarderia::devolver(Trozo* trozo) {
+    trozo->usado.store(0, std::memory_order_release);  // El GC ya no tiene nada que recorrer en él.
+    std::lock_guard<std::mutex> candado(mutexLibres);
+    trozo->siguienteLibre = libres;
+    libres = trozo;
+}
+
+// Método para renovar el trozo del hilo
+// Qué sucede: Si todos los espacios del trozo ya se liberaron, reinicia el cursor en el mismo trozo.
+// Si no, lo retira y toma uno de la reserva o, si está vacía, uno nuevo.
+// Por qué sucede: Con objetos de vida corta el caso común es el primero, y el hilo vuelve a llenar
+// la misma memoria, ya en caché, sin candados.
+// Qué deberíamos esperar: El cursor queda con lugar para al menos un espacio admitido.
+void Guarderia::renovar() {
+    static thread_local DuenoTrozo dueno;  // Se construye la primera vez que el hilo toma un trozo.
+    (void)dueno;
+    Cursor& cursor = cursorDelHilo;
+    if (cursor.trozo != nullptr) {
+        char* inicio = reinterpret_cast<char*>(cursor.trozo) + INICIO_ESPACIOS;
+        MPointerGC::getInstance().avisarPresionJoven(static_cast<std::size_t>(cursor.libre - inicio));
+        if (cursor.trozo->vivos.load(std::memory_order_acquire) == RETENCION - cursor.reservados) {
+            // Nadie más puede liberar: no queda ningún espacio tomado.
+            cursor.trozo->vivos.store(RETENCION, std::memory_order_relaxed);
+            cursor.trozo->usado.store(0, std::memory_order_release);
+            cursor.libre = inicio;
+            cursor.reservados = 0;
+            return;
+        }
+        retirar(cursor);
+    }
+
+    Trozo* trozo = nullptr;
+    {
+        std::lock_guard<std::mutex> candado(mutexLibres);
+        if (libres != nullptr) {
+            trozo = libres;
+            libres = trozo->siguienteLibre;
+        }
+    }
+    if (trozo == nullptr) {
+        trozo = static_cast<Trozo*>(::operator new(BYTES_TROZO, std::align_val_t(BYTES_TROZO)));
+        ::new (static_cast<void*>(trozo)) Trozo{};
+        trozo->usado.store(0, std::memory_order_relaxed);
+        trozo->asignaciones.store(0, std::memory_order_relaxed);
+        trozo->bytesAsignados.store(0, std::memory_order_relaxed);
+        trozo->siguienteLibre = nullptr;
+        trozo->siguienteTodos = todos.load(std::memory_order_relaxed);
+        while (!todos.compare_exchange_weak(trozo->siguienteTodos, trozo, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+    trozo->vivos.store(RETENCION, std::memory_order_relaxed);
+    char* inicio = reinterpret_cast<char*>(trozo) + INICIO_ESPACIOS;
+    cursor = Cursor{trozo, inicio, reinterpret_cast<char*>(trozo) + BYTES_TROZO, 0};
+}
+
+// Método para sumar los contadores de todos los trozos
+Guarderia::Estadisticas Guarderia::estadisticas() {
+    Estadisticas estadisticas;
+    for (Trozo* trozo = todos.load(std::memory_order_acquire); trozo != nullptr; trozo = trozo->siguienteTodos) {
+        estadisticas.asignaciones += trozo->asignaciones.load(std::memory_order_relaxed);
+        estadisticas.bytesAsignados += trozo->bytesAsignados.load(std::memory_order_relaxed);
+        estadisticas.trozos++;
+    }
+    return estadisticas;
+}
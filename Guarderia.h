@@ -0,0 +1,140 @@
+#ifndef GUARDERIA_H
+#define GUARDERIA_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+// Guardería del modo generacional del GC: el espacio donde nacen los objetos jóvenes
+// Qué sucede: Cada hilo reserva avanzando un cursor dentro de su propio trozo de BYTES_TROZO,
+// sin candados ni registro. Cada trozo cuenta cuántos espacios siguen tomados; cuando el hilo lo
+// llena y ya no queda ninguno, vuelve el cursor al principio y lo reutiliza. Si queda alguno, el
+// trozo se retira y el último espacio que se libere (desde cualquier hilo) lo devuelve a una reserva
+// común de trozos vacíos.
+// Por qué sucede: La mayoría de los objetos temporales muere antes de la próxima recolección, así que
+// nacer y morir sin tocar el registro del GC ni una lista de libres es lo que más se ahorra.
+// Qué deberíamos esperar: Los objetos no se mueven: el GC recorre los trozos, analiza los jóvenes vivos
+// y registra a los sobrevivientes (los promueve) donde están. Un sobreviviente retiene su trozo hasta
+// morir. Los trozos no se devuelven nunca al sistema.
+class Guarderia {
+public:
+    static constexpr std::size_t BYTES_TROZO = 64u << 10;
+    static constexpr std::size_t GRANULO = 16;  // Todo espacio mide un múltiplo de esto y queda alineado a esto
+
+    // Indica si un objeto de este tamaño y alineación puede nacer en la guardería
+    static constexpr bool admite(std::size_t bytes, std::size_t alineacion) {
+        return alineacion <= GRANULO && bytes <= BYTES_TROZO / 16;
+    }
+
+    static constexpr std::size_t redondear(std::size_t bytes) {
+        return (bytes + GRANULO - 1) / GRANULO * GRANULO;
+    }
+
+    // Contadores de todos los trozos, leídos sin candados
+    struct Estadisticas {
+        std::uint64_t asignaciones = 0;  // Espacios reservados desde que empezó el programa
+        std::uint64_t bytesAsignados = 0;
+        std::uint64_t trozos = 0;  // Trozos pedidos al sistema
+    };
+
+    // Indica si MPointer::New crea los objetos en la guardería (MPointerGC::setGenerationalMode)
+    static bool activa() {
+        return activada.load(std::memory_order_relaxed);
+    }
+
+    static void activar(bool valor) {
+        activada.store(valor, std::memory_order_relaxed);
+    }
+
+    // Reserva un espacio de `bytes` (redondeado y admitido) en el trozo del hilo
+    // `preparar(espacio)` escribe la cabecera del objeto antes de que el espacio sea visible para
+    // el GC, así que un recorrido nunca encuentra un espacio sin cabecera.
+    template <typename Preparar>
+    static void* reservar(std::size_t bytes, Preparar preparar) {
+        Cursor& cursor = cursorDelHilo;
+        if (static_cast<std::size_t>(cursor.fin - cursor.libre) < bytes) {
+            renovar();
+        }
+        char* espacio = cursor.libre;
+        cursor.libre += bytes;
+        cursor.reservados++;
+        preparar(espacio);
+        Trozo* trozo = cursor.trozo;  // Los contadores de un trozo en uso solo los escribe su hilo.
+        trozo->asignaciones.store(trozo->asignaciones.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        trozo->bytesAsignados.store(trozo->bytesAsignados.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+        trozo->usado.store(static_cast<std::size_t>(cursor.libre - reinterpret_cast<char*>(trozo)), std::memory_order_release);
+        return espacio;
+    }
+
+    // Devuelve un espacio, desde cualquier hilo; el trozo se ubica por su alineación
+    static void liberar(void* espacio) {
+        Trozo* trozo = reinterpret_cast<Trozo*>(reinterpret_cast<std::uintptr_t>(espacio) & ~(BYTES_TROZO - 1));
+        if (trozo->vivos.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            devolver(trozo);
+        }
+    }
+
+    // Recorre los espacios publicados de todos los trozos, con los mutadores detenidos
+    // `visitar(espacio)` devuelve el tamaño del espacio, leído de su cabecera.
+    template <typename Visitante>
+    static void recorrer(Visitante visitar) {
+        for (Trozo* trozo = todos.load(std::memory_order_acquire); trozo != nullptr; trozo = trozo->siguienteTodos) {
+            char* inicio = reinterpret_cast<char*>(trozo);
+            char* fin = inicio + trozo->usado.load(std::memory_order_acquire);
+            for (char* espacio = inicio + INICIO_ESPACIOS; espacio < fin;) {
+                espacio += redondear(visitar(static_cast<void*>(espacio)));
+            }
+        }
+    }
+
+    static Estadisticas estadisticas();
+
+private:
+    // Cabecera al inicio de cada trozo
+    struct Trozo {
+        // Espacios tomados y no liberados. Mientras un hilo asigna en el trozo, además guarda RETENCION
+        // menos los espacios que reservó: así reservar no toca este contador y nunca llega a 0.
+        std::atomic<std::int64_t> vivos;
+        std::atomic<std::size_t> usado;  // Fin de lo publicado, desde el inicio del trozo
+        std::atomic<std::uint64_t> asignaciones;
+        std::atomic<std::uint64_t> bytesAsignados;
+        Trozo* siguienteTodos;  // Lista de todos los trozos, que solo crece
+        Trozo* siguienteLibre;  // Reserva de trozos vacíos
+    };
+
+    // Trozo del hilo y su cursor. Trivial, para que el camino rápido no pase por la inicialización
+    // de un thread_local; el que suelta el trozo al terminar el hilo es DuenoTrozo.
+    struct Cursor {
+        Trozo* trozo;
+        char* libre;
+        char* fin;
+        std::int64_t reservados;  // Espacios reservados en el trozo desde que se tomó o se reinició
+    };
+
+    struct DuenoTrozo {
+        ~DuenoTrozo();
+    };
+
+    static constexpr std::size_t INICIO_ESPACIOS = (sizeof(Trozo) + 63) / 64 * 64;
+    static constexpr std::int64_t RETENCION = BYTES_TROZO / GRANULO + 1;  // Más que los espacios que entran
+
+    static inline std::atomic<bool> activada{false};
+    static inline thread_local Cursor cursorDelHilo{nullptr, nullptr, nullptr, 0};
+    static inline std::atomic<Trozo*> todos{nullptr};
+
+    // Reserva común de trozos vacíos
+    static std::mutex mutexLibres;
+    static Trozo* libres;
+
+    // Reutiliza el trozo del hilo si quedó vacío, o lo retira y toma otro
+    static void renovar();
+
+    // Suelta la retención del hilo sobre su trozo
+    static void retirar(Cursor& cursor);
+
+    // Pone un trozo vacío en la reserva común
+    static void devolver(Trozo* trozo);
+};
+
+#endif
@@ -0,0 +1,251 @@
+#ifndef INDICELISTA_H
+#define INDICELISTA_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Nodo.h"
+
+// Índice posicional de una lista doblemente enlazada: una skip list indexable cuyos niveles
+// guardan punteros a algunos nodos de la lista y cuántas posiciones hay hasta el siguiente.
+// Qué sucede: El nivel 0 es la lista misma; en el nivel 1 aparece uno de cada ~4 nodos, en el 2 uno
+// de cada ~16, y así. Cada entrada sabe su `ancho`, la distancia en nodos a la próxima entrada del nivel.
+// Por qué sucede: Bajar desde el nivel más alto sumando anchos llega a cualquier posición, o al
+// primer valor no menor en una lista ordenada, en O(log n) esperado, leyendo pocos nodos de la lista.
+// Qué deberíamos esperar: Los nodos no cambian (no hay torres en Nodo): el índice vive aparte, en un
+// arreglo de entradas de ~1/3 de la cantidad de nodos. Quien modifica la lista lo avisa con
+// `insertado` y `eliminado`, o lo invalida y lo vuelve a `construir` cuando lo necesita.
+// Las posiciones son 0, 1, ..., tamano() - 1; dentro del índice la cabeza ocupa la posición 0 y el
+// nodo de la posición k la k + 1.
+template <typename T, typename Politica = PoliticaPorDefecto>
+class IndiceLista {
+private:
+    using NodoLista = Nodo<T, Politica>;
+
+    static constexpr std::uint32_t SIN_ENTRADA = 0xFFFFFFFFu;
+    static constexpr int MAXIMO_NIVELES = 24;  // 4^24 nodos: más de lo que entra en memoria
+    static constexpr unsigned BITS_POR_NIVEL = 2;  // Un nodo sube de nivel con probabilidad 1/4
+
+    // Entrada de un nodo en un nivel. Las cabezas de los niveles son las primeras MAXIMO_NIVELES
+    // entradas del arreglo y no tienen nodo.
+    struct Entrada {
+        NodoLista* nodo;
+        std::size_t ancho;  // Posiciones hasta la siguiente entrada del nivel, o hasta el final de la lista
+        std::uint32_t siguiente;  // Siguiente entrada del nivel
+        std::uint32_t abajo;  // Entrada del mismo nodo en el nivel de abajo (sin uso en el nivel 1)
+    };
+
+    std::vector<Entrada> entradas;
+    std::uint32_t primeraLibre = SIN_ENTRADA;  // Entradas liberadas, enlazadas por `siguiente`
+    std::size_t cantidad = 0;  // Nodos de la lista
+    int niveles = 0;  // Niveles en uso; 0 mientras el índice no está construido
+    std::uint64_t semilla = 0x9E3779B97F4A7C15ull;  // Estado del generador de alturas
+
+    static std::uint32_t cabeza(int nivel) {
+        return static_cast<std::uint32_t>(nivel - 1);
+    }
+
+    static NodoLista* siguienteNodo(NodoLista* nodo) {
+        return VistaNodo<T, Politica>(nodo->siguiente).get();
+    }
+
+    // Altura de un nodo nuevo: la cantidad de pares de bits bajos en cero de un número al azar (xorshift)
+    int alturaAlAzar() {
+        semilla ^= semilla << 13;
+        semilla ^= semilla >> 7;
+        semilla ^= semilla << 17;
+        int altura = 0;
+        for (std::uint64_t bits = semilla; altura < MAXIMO_NIVELES && (bits & ((1u << BITS_POR_NIVEL) - 1)) == 0; bits >>= BITS_POR_NIVEL) {
+            altura++;
+        }
+        return altura;
+    }
+
+    std::uint32_t nuevaEntrada(NodoLista* nodo, std::size_t ancho, std::uint32_t siguiente, std::uint32_t abajo) {
+        std::uint32_t indice = primeraLibre;
+        if (indice != SIN_ENTRADA) {
+            primeraLibre = entradas[indice].siguiente;
+            entradas[indice] = {nodo, ancho, siguiente, abajo};
+        } else {
+            indice = static_cast<std::uint32_t>(entradas.size());
+            entradas.push_back({nodo, ancho, siguiente, abajo});
+        }
+        return indice;
+    }
+
+    // Baja desde el nivel más alto hasta la última entrada de cada nivel cuya posición cumple
+    // `posicion < objetivo` (o `<=` si `incluido`); deja esa entrada y su posición en `camino`.
+    void bajar(std::size_t objetivo, bool incluido, std::uint32_t* camino, std::size_t* posiciones) const {
+        assert(vigente() && "IndiceLista: el índice no está construido");
+        std::uint32_t actual = cabeza(niveles);
+        std::size_t posicion = 0;
+        for (int nivel = niveles; nivel >= 1; nivel--) {
+            for (;;) {
+                const Entrada& entrada = entradas[actual];
+                std::size_t proxima = posicion + entrada.ancho;
+                if (entrada.siguiente == SIN_ENTRADA || (incluido ? proxima > objetivo : proxima >= objetivo)) {
+                    break;
+                }
+                posicion = proxima;
+                actual = entrada.siguiente;
+            }
+            camino[nivel - 1] = actual;
+            posiciones[nivel - 1] = posicion;
+            if (nivel > 1) {
+                actual = entradas[actual].abajo;
+            }
+        }
+    }
+
+public:
+    // Indica si el índice refleja la lista
+    bool vigente() const {
+        return niveles > 0;
+    }
+
+    // Descarta el índice; el próximo uso tendrá que construirlo de nuevo
+    void invalidar() {
+        entradas.clear();
+        entradas.shrink_to_fit();
+        primeraLibre = SIN_ENTRADA;
+        cantidad = 0;
+        niveles = 0;
+    }
+
+    // Construye el índice recorriendo la lista una vez desde `primero`, en O(n)
+    // El nodo de la posición k sube tantos niveles como veces divide 4 a k + 1: una skip list perfecta,
+    // que las inserciones posteriores mantienen equilibrada en promedio con alturas al azar.
+    void construir(NodoLista* primero) {
+        invalidar();
+        entradas.reserve(MAXIMO_NIVELES);
+        for (int nivel = 1; nivel <= MAXIMO_NIVELES; nivel++) {
+            entradas.push_back({nullptr, 0, SIN_ENTRADA, nivel > 1 ? cabeza(nivel - 1) : SIN_ENTRADA});
+        }
+        std::uint32_t ultimas[MAXIMO_NIVELES];
+        std::size_t posicionesUltimas[MAXIMO_NIVELES] = {};
+        for (int nivel = 1; nivel <= MAXIMO_NIVELES; nivel++) {
+            ultimas[nivel - 1] = cabeza(nivel);
+        }
+        niveles = 1;
+        std::size_t posicion = 0;
+        for (NodoLista* nodo = primero; nodo != nullptr; nodo = siguienteNodo(nodo)) {
+            posicion++;
+            std::uint32_t abajo = SIN_ENTRADA;
+            for (int nivel = 1; nivel <= MAXIMO_NIVELES && (posicion & ((std::size_t(1) << (BITS_POR_NIVEL * nivel)) - 1)) == 0; nivel++) {
+                std::uint32_t entrada = nuevaEntrada(nodo, 0, SIN_ENTRADA, abajo);
+                entradas[ultimas[nivel - 1]].siguiente = entrada;
+                entradas[ultimas[nivel - 1]].ancho = posicion - posicionesUltimas[nivel - 1];
+                ultimas[nivel - 1] = entrada;
+                posicionesUltimas[nivel - 1] = posicion;
+                abajo = entrada;
+                niveles = nivel > niveles ? nivel : niveles;
+            }
+        }
+        cantidad = posicion;
+        for (int nivel = 1; nivel <= MAXIMO_NIVELES; nivel++) {  // La última entrada mide hasta el final.
+            entradas[ultimas[nivel - 1]].ancho = cantidad + 1 - posicionesUltimas[nivel - 1];
+        }
+    }
+
+    // Cantidad de nodos de la lista
+    std::size_t tamano() const {
+        return cantidad;
+    }
+
+    // Nodo de la posición `posicion` (menor que tamano()), en O(log n) esperado
+    NodoLista* buscar(NodoLista* primero, std::size_t posicion) const {
+        std::uint32_t camino[MAXIMO_NIVELES] = {};
+        std::size_t posiciones[MAXIMO_NIVELES] = {};
+        bajar(posicion + 1, true, camino, posiciones);
+        NodoLista* nodo = posiciones[0] == 0 ? primero : entradas[camino[0]].nodo;
+        for (std::size_t paso = posiciones[0] == 0 ? 1 : posiciones[0]; paso < posicion + 1; paso++) {
+            nodo = siguienteNodo(nodo);
+        }
+        return nodo;
+    }
+
+    // Primer nodo cuyo valor no es menor que `valor` según `menor`, o nullptr; la lista debe estar ordenada
+    // Deja en `posicion` (si no es nullptr) la posición del nodo, o tamano() si no hay ninguno.
+    template <typename Comparador>
+    NodoLista* cotaInferior(NodoLista* primero, const T& valor, Comparador menor, std::size_t* posicion = nullptr) const {
+        std::uint32_t actual = cabeza(niveles);
+        std::size_t desde = 0;
+        for (int nivel = niveles; nivel >= 1; nivel--) {
+            for (;;) {
+                const Entrada& entrada = entradas[actual];
+                if (entrada.siguiente == SIN_ENTRADA || !menor(entradas[entrada.siguiente].nodo->data, valor)) {
+                    break;
+                }
+                desde += entrada.ancho;
+                actual = entrada.siguiente;
+            }
+            if (nivel > 1) {
+                actual = entradas[actual].abajo;
+            }
+        }
+        // `actual` es el último nodo indexado menor que `valor`: la respuesta está a menos de un salto.
+        NodoLista* nodo = desde == 0 ? primero : siguienteNodo(entradas[actual].nodo);
+        std::size_t encontrado = desde;
+        while (nodo != nullptr && menor(nodo->data, valor)) {
+            nodo = siguienteNodo(nodo);
+            encontrado++;
+        }
+        if (posicion != nullptr) {
+            *posicion = encontrado;
+        }
+        return nodo;
+    }
+
+    // Registra un nodo que ya se enlazó en la posición `posicion` (hasta tamano()), en O(log n) esperado
+    void insertado(std::size_t posicion, NodoLista* nodo) {
+        std::uint32_t camino[MAXIMO_NIVELES];
+        std::size_t posiciones[MAXIMO_NIVELES];
+        int altura = alturaAlAzar();
+        if (altura > niveles) {  // El nodo estrena niveles: sus cabezas miden hasta el final.
+            for (int nivel = niveles + 1; nivel <= altura; nivel++) {
+                entradas[cabeza(nivel)].ancho = cantidad + 1;
+            }
+            niveles = altura;
+        }
+        bajar(posicion + 1, false, camino, posiciones);
+        std::uint32_t abajo = SIN_ENTRADA;
+        for (int nivel = 1; nivel <= niveles; nivel++) {
+            Entrada& anterior = entradas[camino[nivel - 1]];
+            if (nivel <= altura) {
+                // Parte el salto de la anterior: hasta el nodo nuevo y del nodo nuevo a la siguiente.
+                std::size_t hastaNuevo = posicion + 1 - posiciones[nivel - 1];
+                std::uint32_t entrada = nuevaEntrada(nodo, anterior.ancho + 1 - hastaNuevo, anterior.siguiente, abajo);
+                entradas[camino[nivel - 1]].ancho = hastaNuevo;  // `anterior` pudo moverse al crecer el arreglo.
+                entradas[camino[nivel - 1]].siguiente = entrada;
+                abajo = entrada;
+            } else {
+                anterior.ancho++;
+            }
+        }
+        cantidad++;
+    }
+
+    // Olvida el nodo de la posición `posicion` (menor que tamano()), antes o después de desenlazarlo
+    void eliminado(std::size_t posicion) {
+        std::uint32_t camino[MAXIMO_NIVELES];
+        std::size_t posiciones[MAXIMO_NIVELES];
+        bajar(posicion + 1, false, camino, posiciones);
+        for (int nivel = 1; nivel <= niveles; nivel++) {
+            Entrada& anterior = entradas[camino[nivel - 1]];
+            std::uint32_t siguiente = anterior.siguiente;
+            if (siguiente != SIN_ENTRADA && posiciones[nivel - 1] + anterior.ancho == posicion + 1) {
+                // El nodo tenía entrada en este nivel: la anterior absorbe su salto.
+                anterior.ancho += entradas[siguiente].ancho - 1;
+                anterior.siguiente = entradas[siguiente].siguiente;
+                entradas[siguiente].siguiente = primeraLibre;
+                primeraLibre = siguiente;
+            } else {
+                anterior.ancho--;
+            }
+        }
+        cantidad--;
+    }
+};
+
+#endif
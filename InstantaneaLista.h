@@ -0,0 +1,513 @@
+#ifndef INSTANTANEALISTA_H
+#define INSTANTANEALISTA_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ListaDoble.h"
+
+// Instantáneas de listas en disco
+// Qué sucede: Una lista se guarda como una cabecera de 64 bytes seguida de sus valores en orden. La
+// cabecera ubica los datos por desplazamientos desde el inicio del archivo; no hay punteros guardados.
+// Por qué sucede: Reconstruir listas grandes elemento por elemento al reiniciar domina el arranque.
+// Sin punteros, el archivo sirve en cualquier dirección: se puede mapear con mmap y leer en el lugar.
+// Qué deberíamos esperar: Con T trivialmente copiable (formato plano) los valores forman un arreglo
+// que InstantaneaMapeada expone sin copiar. Con otros T (formato de registros) cada valor se escribe
+// con SerializacionInstantanea<T> y se lee de una sola pasada. El archivo usa el orden de bytes de la
+// máquina que lo escribió.
+
+// Formatos de los datos de una instantánea
+enum class FormatoInstantanea : std::uint32_t {
+    Plano = 0,  // Arreglo de T, copiado byte a byte
+    Registros = 1  // Un registro por valor, escrito por SerializacionInstantanea<T>
+};
+
+// Cabecera al inicio del archivo. Los datos empiezan en `inicioDatos`, alineados a 64 bytes.
+struct CabeceraInstantanea {
+    char magia[8];  // "MPLISTA"
+    std::uint32_t version;
+    FormatoInstantanea formato;
+    std::uint64_t bytesElemento;  // sizeof(T) en el formato plano, 0 en el de registros
+    std::uint64_t alineacion;  // alignof(T) en el formato plano, 0 en el de registros
+    std::uint64_t cantidad;  // Valores guardados
+    std::uint64_t inicioDatos;  // Desplazamiento de los datos desde el inicio del archivo
+    std::uint64_t bytesDatos;  // Tamaño de los datos
+    std::uint64_t reservado;
+};
+static_assert(sizeof(CabeceraInstantanea) == 64, "La cabecera ocupa una línea de caché");
+
+constexpr char MAGIA_INSTANTANEA[8] = {'M', 'P', 'L', 'I', 'S', 'T', 'A', '\0'};
+constexpr std::uint32_t VERSION_INSTANTANEA = 1;
+
+// Escritura secuencial con un búfer propio: una llamada a `write` por búfer lleno (1 MiB por defecto),
+// no una por valor
+class EscritorInstantanea {
+public:
+    static constexpr std::size_t BYTES_BUFER = 1u << 20;
+
+    explicit EscritorInstantanea(const std::string& ruta, std::size_t bytesBufer = BYTES_BUFER) : bufer(bytesBufer) {
+        descriptor = ::open(ruta.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (descriptor < 0) {
+            throw std::system_error(errno, std::generic_category(), "No se pudo crear " + ruta);
+        }
+    }
+
+    EscritorInstantanea(const EscritorInstantanea&) = delete;
+    EscritorInstantanea& operator=(const EscritorInstantanea&) = delete;
+
+    ~EscritorInstantanea() {
+        if (descriptor >= 0) {
+            ::close(descriptor);
+        }
+    }
+
+    void escribir(const void* datos, std::size_t bytes) {
+        if (usados + bytes > bufer.size()) {
+            vaciar();
+            if (bytes >= bufer.size()) {  // Los bloques grandes van directo al archivo.
+                escribirTodo(datos, bytes);
+                escritos += bytes;
+                return;
+            }
+        }
+        std::memcpy(bufer.data() + usados, datos, bytes);
+        usados += bytes;
+        escritos += bytes;
+    }
+
+    template <typename V>
+    void escribirValor(const V& valor) {
+        static_assert(std::is_trivially_copyable<V>::value, "Solo se escriben byte a byte valores trivialmente copiables");
+        escribir(std::addressof(valor), sizeof(V));
+    }
+
+    // Bytes escritos desde el inicio del archivo
+    std::uint64_t posicion() const {
+        return escritos;
+    }
+
+    // Reescribe bytes ya escritos (la cabecera, al terminar)
+    void reescribir(std::uint64_t desplazamiento, const void* datos, std::size_t bytes) {
+        vaciar();
+        if (::pwrite(descriptor, datos, bytes, static_cast<off_t>(desplazamiento)) != static_cast<ssize_t>(bytes)) {
+            throw std::system_error(errno, std::generic_category(), "No se pudo escribir la instantánea");
+        }
+    }
+
+    // Vacía el búfer y espera a que los datos lleguen al disco antes de cerrar
+    void cerrar() {
+        vaciar();
+        if (::fsync(descriptor) != 0) {
+            int error = errno;
+            ::close(descriptor);
+            descriptor = -1;
+            throw std::system_error(error, std::generic_category(), "No se pudo sincronizar la instantánea");
+        }
+        int resultado = ::close(descriptor);
+        descriptor = -1;
+        if (resultado != 0) {
+            throw std::system_error(errno, std::generic_category(), "No se pudo cerrar la instantánea");
+        }
+    }
+
+private:
+    int descriptor;
+    std::vector<char> bufer;
+    std::size_t usados = 0;
+    std::uint64_t escritos = 0;
+
+    void vaciar() {
+        escribirTodo(bufer.data(), usados);
+        usados = 0;
+    }
+
+    void escribirTodo(const void* datos, std::size_t bytes) {
+        const char* actual = static_cast<const char*>(datos);
+        while (bytes > 0) {
+            ssize_t hecho = ::write(descriptor, actual, bytes);
+            if (hecho < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "No se pudo escribir la instantánea");
+            }
+            actual += hecho;
+            bytes -= static_cast<std::size_t>(hecho);
+        }
+    }
+};
+
+// Lectura secuencial con un búfer propio, la contraparte de EscritorInstantanea
+class LectorInstantanea {
+public:
+    static constexpr std::size_t BYTES_BUFER = 1u << 20;
+
+    explicit LectorInstantanea(const std::string& ruta, std::size_t bytesBufer = BYTES_BUFER) : bufer(bytesBufer) {
+        descriptor = ::open(ruta.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0) {
+            throw std::system_error(errno, std::generic_category(), "No se pudo abrir " + ruta);
+        }
+        ::posix_fadvise(descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    LectorInstantanea(const LectorInstantanea&) = delete;
+    LectorInstantanea& operator=(const LectorInstantanea&) = delete;
+
+    ~LectorInstantanea() {
+        ::close(descriptor);
+    }
+
+    // Lee exactamente `bytes`; un archivo más corto es una instantánea truncada
+    void leer(void* destino, std::size_t bytes) {
+        char* actual = static_cast<char*>(destino);
+        while (bytes > 0) {
+            if (inicio == fin) {
+                if (bytes >= bufer.size()) {  // Los bloques grandes se leen directo al destino.
+                    std::size_t hecho = leerDelArchivo(actual, bytes);
+                    actual += hecho;
+                    bytes -= hecho;
+                    continue;
+                }
+                fin = leerDelArchivo(bufer.data(), bufer.size());
+                inicio = 0;
+            }
+            std::size_t tomados = std::min(bytes, fin - inicio);
+            std::memcpy(actual, bufer.data() + inicio, tomados);
+            inicio += tomados;
+            actual += tomados;
+            bytes -= tomados;
+        }
+    }
+
+    template <typename V>
+    V leerValor() {
+        static_assert(std::is_trivially_copyable<V>::value, "Solo se leen byte a byte valores trivialmente copiables");
+        V valor;
+        leer(std::addressof(valor), sizeof(V));
+        return valor;
+    }
+
+private:
+    int descriptor;
+    std::vector<char> bufer;
+    std::size_t inicio = 0;
+    std::size_t fin = 0;
+
+    std::size_t leerDelArchivo(char* destino, std::size_t maximo) {
+        while (true) {
+            ssize_t hecho = ::read(descriptor, destino, maximo);
+            if (hecho > 0) {
+                return static_cast<std::size_t>(hecho);
+            }
+            if (hecho == 0) {
+                throw std::runtime_error("Instantánea truncada");
+            }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "No se pudo leer la instantánea");
+            }
+        }
+    }
+};
+
+// Cómo se escribe y se lee un valor en el formato de registros
+// Se especializa para cada tipo que no es trivialmente copiable; `leer` devuelve el valor construido.
+template <typename T>
+struct SerializacionInstantanea;
+
+// Cadenas: la longitud y después los caracteres
+template <typename Caracter, typename Rasgos, typename Asignador>
+struct SerializacionInstantanea<std::basic_string<Caracter, Rasgos, Asignador>> {
+    using Cadena = std::basic_string<Caracter, Rasgos, Asignador>;
+
+    static void escribir(EscritorInstantanea& escritor, const Cadena& cadena) {
+        escritor.escribirValor(static_cast<std::uint64_t>(cadena.size()));
+        escritor.escribir(cadena.data(), cadena.size() * sizeof(Caracter));
+    }
+
+    static Cadena leer(LectorInstantanea& lector) {
+        Cadena cadena(static_cast<std::size_t>(lector.leerValor<std::uint64_t>()), Caracter());
+        lector.leer(&cadena[0], cadena.size() * sizeof(Caracter));
+        return cadena;
+    }
+};
+
+namespace detalle {
+
+template <typename T>
+constexpr bool instantaneaPlana() {
+    return std::is_trivially_copyable<T>::value;
+}
+
+template <typename T>
+CabeceraInstantanea cabeceraPara(std::uint64_t cantidad, std::uint64_t bytesDatos) {
+    CabeceraInstantanea cabecera{};
+    std::memcpy(cabecera.magia, MAGIA_INSTANTANEA, sizeof(cabecera.magia));
+    cabecera.version = VERSION_INSTANTANEA;
+    cabecera.formato = instantaneaPlana<T>() ? FormatoInstantanea::Plano : FormatoInstantanea::Registros;
+    cabecera.bytesElemento = instantaneaPlana<T>() ? sizeof(T) : 0;
+    cabecera.alineacion = instantaneaPlana<T>() ? alignof(T) : 0;
+    cabecera.cantidad = cantidad;
+    cabecera.inicioDatos = sizeof(CabeceraInstantanea);
+    cabecera.bytesDatos = bytesDatos;
+    return cabecera;
+}
+
+// Comprueba que la cabecera describa valores de tipo T dentro de un archivo de `bytesArchivo` bytes
+template <typename T>
+void validarCabecera(const CabeceraInstantanea& cabecera, std::uint64_t bytesArchivo) {
+    if (std::memcmp(cabecera.magia, MAGIA_INSTANTANEA, sizeof(cabecera.magia)) != 0) {
+        throw std::runtime_error("El archivo no es una instantánea de lista");
+    }
+    if (cabecera.version != VERSION_INSTANTANEA) {
+        throw std::runtime_error("Versión de instantánea no soportada");
+    }
+    CabeceraInstantanea esperada = cabeceraPara<T>(cabecera.cantidad, cabecera.bytesDatos);
+    if (cabecera.formato != esperada.formato || cabecera.bytesElemento != esperada.bytesElemento
+        || cabecera.alineacion != esperada.alineacion) {
+        throw std::runtime_error("La instantánea guarda valores de otro tipo");
+    }
+    if (cabecera.inicioDatos < sizeof(CabeceraInstantanea) || cabecera.inicioDatos % 64 != 0
+        || cabecera.inicioDatos > bytesArchivo || cabecera.bytesDatos > bytesArchivo - cabecera.inicioDatos
+        || (cabecera.formato == FormatoInstantanea::Plano
+            && (cabecera.bytesDatos % sizeof(T) != 0 || cabecera.bytesDatos / sizeof(T) != cabecera.cantidad))) {
+        throw std::runtime_error("Instantánea truncada o dañada");
+    }
+}
+
+// Sincroniza el directorio que contiene `ruta`, para que un renombre en él llegue al disco
+inline void sincronizarDirectorio(const std::string& ruta) {
+    std::string::size_type barra = ruta.find_last_of('/');
+    std::string directorio = barra == std::string::npos ? "." : barra == 0 ? "/" : ruta.substr(0, barra);
+    int descriptor = ::open(directorio.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (descriptor < 0) {
+        throw std::system_error(errno, std::generic_category(), "No se pudo abrir " + directorio);
+    }
+    int resultado = ::fsync(descriptor);
+    int error = errno;
+    ::close(descriptor);
+    if (resultado != 0) {
+        throw std::system_error(error, std::generic_category(), "No se pudo sincronizar " + directorio);
+    }
+}
+
+// Escribe una instantánea de valores T en `ruta`.tmp y la renombra a `ruta` al terminar
+// `escribirDatos(EscritorInstantanea&)` escribe los valores y devuelve cuántos fueron. El temporal
+// se sincroniza antes de renombrarlo y el directorio después; si algo falla, se borra el temporal.
+template <typename T, typename EscribirDatos>
+void escribirInstantanea(const std::string& ruta, EscribirDatos escribirDatos) {
+    static_assert(alignof(T) <= 64, "Los datos de la instantánea se alinean a 64 bytes");
+    const std::string temporal = ruta + ".tmp";
+    EscritorInstantanea escritor(temporal);
+    try {
+        CabeceraInstantanea cabecera = cabeceraPara<T>(0, 0);
+        escritor.escribirValor(cabecera);  // Se completa al final, cuando se conoce la cantidad.
+        std::uint64_t cantidad = escribirDatos(escritor);
+        cabecera = cabeceraPara<T>(cantidad, escritor.posicion() - sizeof(CabeceraInstantanea));
+        escritor.reescribir(0, &cabecera, sizeof(cabecera));
+        escritor.cerrar();
+        if (std::rename(temporal.c_str(), ruta.c_str()) != 0) {
+            throw std::system_error(errno, std::generic_category(), "No se pudo reemplazar " + ruta);
+        }
+    } catch (...) {
+        ::unlink(temporal.c_str());
+        throw;
+    }
+    sincronizarDirectorio(ruta);
+}
+
+// Lee y valida la cabecera de una instantánea de valores T; deja `lector` al inicio de los datos
+template <typename T>
+CabeceraInstantanea abrirInstantanea(LectorInstantanea& lector, const std::string& ruta) {
+    CabeceraInstantanea cabecera = lector.leerValor<CabeceraInstantanea>();
+    struct stat datosArchivo;
+    if (::stat(ruta.c_str(), &datosArchivo) != 0) {
+        throw std::system_error(errno, std::generic_category(), "No se pudo consultar " + ruta);
+    }
+    validarCabecera<T>(cabecera, static_cast<std::uint64_t>(datosArchivo.st_size));
+    std::vector<char> relleno(static_cast<std::size_t>(cabecera.inicioDatos - sizeof(CabeceraInstantanea)));
+    lector.leer(relleno.data(), relleno.size());
+    return cabecera;
+}
+
+}  // namespace detalle
+
+// Función para guardar un rango como instantánea
+// Qué sucede: Escribe la cabecera y los valores de [primero, ultimo) en `ruta`, en orden.
+// Por qué sucede: Se escribe primero en `ruta`.tmp, se sincroniza y después se renombra (y se
+// sincroniza el directorio), así que ni un error ni un corte a mitad de la escritura dejan una
+// instantánea a medias en `ruta`: queda la anterior o la nueva completa.
+// Qué deberíamos esperar: Un archivo que cargarInstantanea o InstantaneaMapeada leen en el mismo
+// orden. Con un rango contiguo de valores planos, los datos se escriben con una sola copia.
+template <typename Iterador>
+void guardarInstantanea(Iterador primero, Iterador ultimo, const std::string& ruta) {
+    using T = typename std::iterator_traits<Iterador>::value_type;
+    detalle::escribirInstantanea<T>(ruta, [&](EscritorInstantanea& escritor) {
+        std::uint64_t cantidad = 0;
+        if constexpr (detalle::instantaneaPlana<T>() && std::is_pointer<Iterador>::value) {
+            cantidad = static_cast<std::uint64_t>(ultimo - primero);
+            escritor.escribir(primero, static_cast<std::size_t>(cantidad) * sizeof(T));
+        } else {
+            for (; primero != ultimo; ++primero, ++cantidad) {
+                if constexpr (detalle::instantaneaPlana<T>()) {
+                    escritor.escribirValor<T>(*primero);
+                } else {
+                    SerializacionInstantanea<T>::escribir(escritor, *primero);
+                }
+            }
+        }
+        return cantidad;
+    });
+}
+
+// Función para guardar una lista como instantánea
+// Qué sucede: Recorre la lista con sus iteradores y escribe sus valores en `ruta`.
+// Por qué sucede: El orden de la lista es toda su estructura: los enlaces no se guardan.
+// Qué deberíamos esperar: Lo mismo que guardarInstantanea sobre [begin(), end()).
+template <typename T, typename Politica>
+void guardarInstantanea(const ListaDoble<T, Politica>& lista, const std::string& ruta) {
+    guardarInstantanea(lista.begin(), lista.end(), ruta);
+}
+
+// Vista de solo lectura de una instantánea plana, mapeada con mmap
+// Qué sucede: Mapea el archivo completo y valida su cabecera; los valores se leen en el lugar.
+// Por qué sucede: Un archivo sin punteros puede usarse en cualquier dirección, sin copiarlo ni recorrerlo.
+// Qué deberíamos esperar: Abrir cuesta lo mismo con cualquier tamaño; las páginas se leen del disco
+// (o de la caché del sistema) al tocarlas. Los valores son válidos mientras viva la vista.
+template <typename T>
+class InstantaneaMapeada {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Solo las instantáneas planas se leen en el lugar; usar cargarInstantanea");
+
+public:
+    using const_iterator = const T*;
+
+    explicit InstantaneaMapeada(const std::string& ruta) {
+        int descriptor = ::open(ruta.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0) {
+            throw std::system_error(errno, std::generic_category(), "No se pudo abrir " + ruta);
+        }
+        struct stat datosArchivo;
+        if (::fstat(descriptor, &datosArchivo) != 0) {
+            int error = errno;
+            ::close(descriptor);
+            throw std::system_error(error, std::generic_category(), "No se pudo consultar " + ruta);
+        }
+        bytes = static_cast<std::size_t>(datosArchivo.st_size);
+        if (bytes < sizeof(CabeceraInstantanea)) {
+            ::close(descriptor);
+            throw std::runtime_error("El archivo no es una instantánea de lista");
+        }
+        mapa = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        int error = errno;
+        ::close(descriptor);  // El mapeo sigue vigente sin el descriptor.
+        if (mapa == MAP_FAILED) {
+            mapa = nullptr;
+            throw std::system_error(error, std::generic_category(), "No se pudo mapear " + ruta);
+        }
+        try {
+            const CabeceraInstantanea& cabecera = *static_cast<const CabeceraInstantanea*>(mapa);
+            detalle::validarCabecera<T>(cabecera, bytes);
+            datos = reinterpret_cast<const T*>(static_cast<const char*>(mapa) + cabecera.inicioDatos);
+            cantidad = static_cast<std::size_t>(cabecera.cantidad);
+        } catch (...) {
+            ::munmap(mapa, bytes);
+            throw;
+        }
+    }
+
+    InstantaneaMapeada(InstantaneaMapeada&& otra) noexcept
+        : mapa(std::exchange(otra.mapa, nullptr)), bytes(std::exchange(otra.bytes, 0)),
+          datos(std::exchange(otra.datos, nullptr)), cantidad(std::exchange(otra.cantidad, 0)) {}
+
+    InstantaneaMapeada& operator=(InstantaneaMapeada&& otra) noexcept {
+        if (this != &otra) {
+            liberar();
+            mapa = std::exchange(otra.mapa, nullptr);
+            bytes = std::exchange(otra.bytes, 0);
+            datos = std::exchange(otra.datos, nullptr);
+            cantidad = std::exchange(otra.cantidad, 0);
+        }
+        return *this;
+    }
+
+    InstantaneaMapeada(const InstantaneaMapeada&) = delete;
+    InstantaneaMapeada& operator=(const InstantaneaMapeada&) = delete;
+
+    ~InstantaneaMapeada() {
+        liberar();
+    }
+
+    const T* begin() const {
+        return datos;
+    }
+
+    const T* end() const {
+        return datos + cantidad;
+    }
+
+    const T& operator[](std::size_t indice) const {
+        return datos[indice];
+    }
+
+    std::size_t tamano() const {
+        return cantidad;
+    }
+
+    bool vacia() const {
+        return cantidad == 0;
+    }
+
+private:
+    void* mapa = nullptr;
+    std::size_t bytes = 0;
+    const T* datos = nullptr;
+    std::size_t cantidad = 0;
+
+    void liberar() {
+        if (mapa != nullptr) {
+            ::munmap(mapa, bytes);
+        }
+    }
+};
+
+// Función para cargar una instantánea al final de una lista
+// Qué sucede: Una instantánea plana se mapea y sus valores se agregan con agregarRango; una de
+// registros se lee de una sola pasada, de a bloques de valores.
+// Por qué sucede: En los dos casos los nodos se crean por lotes, sin un `agregar` por elemento.
+// Qué deberíamos esperar: La lista termina con los valores guardados, en el mismo orden.
+template <typename T, typename Politica>
+void cargarInstantanea(const std::string& ruta, ListaDoble<T, Politica>& lista) {
+    if constexpr (detalle::instantaneaPlana<T>()) {
+        InstantaneaMapeada<T> instantanea(ruta);
+        lista.agregarRango(instantanea.begin(), instantanea.end());
+    } else {
+        constexpr std::size_t VALORES_POR_BLOQUE = 4096;
+        LectorInstantanea lector(ruta);
+        CabeceraInstantanea cabecera = detalle::abrirInstantanea<T>(lector, ruta);
+        std::vector<T> bloque;
+        bloque.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(cabecera.cantidad, VALORES_POR_BLOQUE)));
+        for (std::uint64_t restantes = cabecera.cantidad; restantes > 0;) {
+            for (; restantes > 0 && bloque.size() < VALORES_POR_BLOQUE; restantes--) {
+                bloque.push_back(SerializacionInstantanea<T>::leer(lector));
+            }
+            lista.agregarRango(std::make_move_iterator(bloque.begin()), std::make_move_iterator(bloque.end()));
+            bloque.clear();
+        }
+    }
+}
+
+#endif
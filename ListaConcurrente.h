@@ -0,0 +1,184 @@
+#ifndef LISTACONCURRENTE_H
+#define LISTACONCURRENTE_H
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+#include "ListaDoble.h"
+
+// Lista para pasar valores de varios hilos productores a un único consumidor, sin candados
+// Qué sucede: Cada productor engancha su nodo con un solo `exchange` sobre la cola y después publica
+// el enlace desde el nodo anterior (la cola MPSC de Vyukov). El consumidor avanza la cabeza por los
+// enlaces ya publicados y libera el nodo que deja atrás.
+// Por qué sucede: Un productor solo toca el nodo que le devolvió su `exchange`, y el consumidor no
+// puede pasar de ese nodo (ni liberarlo) hasta que el productor publica su `siguiente`. Por eso no
+// hacen falta hazard pointers ni épocas: ningún hilo lee un nodo que otro ya pudo liberar.
+// Qué deberíamos esperar: `agregar` no espera nunca a otro hilo (una instrucción atómica por valor o por
+// lote). Los valores de un mismo productor salen en el orden en que entraron. Si un productor quedó
+// entre su `exchange` y la publicación, el consumidor ve la lista vacía desde ese nodo hasta que termine.
+// Solo un hilo a la vez puede llamar a los métodos del consumidor (`extraer`, `volcarEn`, `vacia`).
+// Los nodos no pasan por el GC: son de la lista hasta que el consumidor saca su valor. Si T es un
+// MPointer, la referencia que viaja en el valor se mueve sin tocar su contador.
+template <typename T>
+class ListaConcurrente {
+private:
+    struct Nodo {
+        std::atomic<Nodo*> siguiente{nullptr};
+        union {
+            T valor;  // Construido por el productor; el nodo centinela no tiene valor
+        };
+
+        Nodo() {}
+        ~Nodo() {}
+    };
+
+    // La cola la escriben los productores y la cabeza el consumidor: cada una en su línea de caché
+    alignas(64) std::atomic<Nodo*> cola;
+    alignas(64) Nodo* cabeza;  // Centinela: el próximo valor está en cabeza->siguiente
+
+    // Nodo con su valor construido a partir de `args`
+    template <typename... Args>
+    static Nodo* crearNodo(Args&&... args) {
+        Nodo* nodo = new Nodo();
+        try {
+            ::new (static_cast<void*>(std::addressof(nodo->valor))) T(std::forward<Args>(args)...);
+        } catch (...) {
+            delete nodo;
+            throw;
+        }
+        return nodo;
+    }
+
+    // Engancha la cadena ya enlazada [primero, ultimo] al final
+    void enganchar(Nodo* primero, Nodo* ultimo) {
+        Nodo* anterior = cola.exchange(ultimo, std::memory_order_acq_rel);
+        anterior->siguiente.store(primero, std::memory_order_release);
+    }
+
+public:
+    // Valores que volcarEn mueve a la lista de destino por cada llamada a agregarRango
+    static constexpr std::size_t VALORES_POR_VOLCADO = 32;
+
+    ListaConcurrente() {
+        Nodo* centinela = new Nodo();
+        cola.store(centinela, std::memory_order_relaxed);
+        cabeza = centinela;
+    }
+
+    // Destruye los valores que nadie extrajo; ningún productor puede estar agregando
+    ~ListaConcurrente() {
+        Nodo* nodo = cabeza->siguiente.load(std::memory_order_acquire);
+        delete cabeza;
+        while (nodo != nullptr) {
+            Nodo* siguiente = nodo->siguiente.load(std::memory_order_acquire);
+            nodo->valor.~T();
+            delete nodo;
+            nodo = siguiente;
+        }
+    }
+
+    ListaConcurrente(const ListaConcurrente&) = delete;
+    ListaConcurrente& operator=(const ListaConcurrente&) = delete;
+
+    // Método para agregar un valor al final desde cualquier hilo
+    // Qué sucede: Construye el nodo fuera de la lista y lo engancha con un `exchange` sobre la cola.
+    // Por qué sucede: La única parte compartida es ese intercambio; reservar y construir es de cada hilo.
+    // Qué deberíamos esperar: El valor queda visible para el consumidor en cuanto se publica el enlace.
+    template <typename... Args>
+    void agregar(Args&&... args) {
+        Nodo* nodo = crearNodo(std::forward<Args>(args)...);
+        enganchar(nodo, nodo);
+    }
+
+    // Método para agregar varios valores juntos desde cualquier hilo
+    // Qué sucede: Enlaza los nodos del rango entre sí y engancha la cadena con un solo `exchange`.
+    // Por qué sucede: Con muchos productores, la línea de la cola se disputa una vez por lote y no por valor.
+    // Qué deberíamos esperar: Los valores del rango salen seguidos y en orden, sin valores de otros
+    // productores entre medio.
+    template <typename Iterador>
+    void agregarRango(Iterador primero, Iterador ultimo) {
+        if (primero == ultimo) {
+            return;
+        }
+        Nodo* inicio = nullptr;
+        Nodo* fin = nullptr;
+        try {
+            for (; primero != ultimo; ++primero) {
+                Nodo* nodo = crearNodo(*primero);
+                if (fin == nullptr) {
+                    inicio = nodo;
+                } else {
+                    fin->siguiente.store(nodo, std::memory_order_relaxed);
+                }
+                fin = nodo;
+            }
+        } catch (...) {
+            while (inicio != nullptr) {  // La cadena todavía es privada: se libera sin publicar nada.
+                Nodo* siguiente = inicio->siguiente.load(std::memory_order_relaxed);
+                inicio->valor.~T();
+                delete inicio;
+                inicio = siguiente;
+            }
+            throw;
+        }
+        enganchar(inicio, fin);
+    }
+
+    // Método para sacar el primer valor (solo el consumidor)
+    // Qué sucede: Si el nodo que sigue al centinela ya está publicado, mueve su valor a `destino`, lo
+    // convierte en el nuevo centinela y libera el anterior.
+    // Por qué sucede: El nodo liberado ya no es la cola (tiene un `siguiente`), así que ningún productor
+    // lo va a tocar.
+    // Qué deberíamos esperar: Devuelve false, sin tocar `destino`, si no hay valores publicados.
+    bool extraer(T& destino) {
+        Nodo* siguiente = cabeza->siguiente.load(std::memory_order_acquire);
+        if (siguiente == nullptr) {
+            return false;
+        }
+        destino = std::move(siguiente->valor);
+        siguiente->valor.~T();
+        delete cabeza;
+        cabeza = siguiente;
+        return true;
+    }
+
+    // Método para pasar los valores publicados a una ListaDoble (solo el consumidor)
+    // Qué sucede: Saca hasta `maximo` valores y los agrega al final de `destino` por lotes de
+    // VALORES_POR_VOLCADO con agregarRango (una reserva y un registro en el GC por lote).
+    // Por qué sucede: Es el uso típico: los productores entregan y el consumidor procesa en una lista común.
+    // Qué deberíamos esperar: Devuelve cuántos valores movió; cero si no había ninguno publicado.
+    template <typename Politica>
+    std::size_t volcarEn(ListaDoble<T, Politica>& destino, std::size_t maximo = std::numeric_limits<std::size_t>::max()) {
+        std::vector<T> lote;
+        lote.reserve(VALORES_POR_VOLCADO);
+        std::size_t movidos = 0;
+        while (movidos < maximo) {
+            Nodo* siguiente = cabeza->siguiente.load(std::memory_order_acquire);
+            if (siguiente == nullptr) {
+                break;
+            }
+            lote.push_back(std::move(siguiente->valor));
+            siguiente->valor.~T();
+            delete cabeza;
+            cabeza = siguiente;
+            movidos++;
+            if (lote.size() == VALORES_POR_VOLCADO) {
+                destino.agregarRango(std::make_move_iterator(lote.begin()), std::make_move_iterator(lote.end()));
+                lote.clear();
+            }
+        }
+        destino.agregarRango(std::make_move_iterator(lote.begin()), std::make_move_iterator(lote.end()));
+        return movidos;
+    }
+
+    // Indica si no hay valores publicados (solo el consumidor; un productor puede agregar justo después)
+    bool vacia() const {
+        return cabeza->siguiente.load(std::memory_order_acquire) == nullptr;
+    }
+};
+
+#endif
@@ -0,0 +1,308 @@
+#ifndef LISTADESENROLLADA_H
+#define LISTADESENROLLADA_H
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "sorting.h"
+
+// Elementos por nodo de ListaDesenrollada: los que entran en 256 bytes (cuatro líneas de caché)
+template <typename T>
+constexpr std::size_t capacidadDesenrollada() {
+    return sizeof(T) >= 256 ? 1 : 256 / sizeof(T);
+}
+
+// Nodo de una lista desenrollada: hasta N elementos contiguos y los enlaces a sus vecinos
+// Los elementos se construyen en el lugar a medida que se agregan, así que T no necesita
+// constructor por defecto. Solo el último nodo de la lista puede estar incompleto.
+template <typename T, std::size_t N>
+class NodoDesenrollado {
+public:
+    std::size_t cantidad = 0;  // Elementos construidos en `almacen`
+    MPointer<NodoDesenrollado> siguiente;  // Puntero al siguiente nodo
+    MPointer<NodoDesenrollado> anterior;   // Puntero al nodo anterior
+
+    NodoDesenrollado() : siguiente(nullptr), anterior(nullptr) {}
+
+    NodoDesenrollado(const NodoDesenrollado&) = delete;
+    NodoDesenrollado& operator=(const NodoDesenrollado&) = delete;
+
+    ~NodoDesenrollado() {
+        for (std::size_t i = 0; i < cantidad; i++) {
+            elemento(i).~T();
+        }
+    }
+
+    bool lleno() const {
+        return cantidad == N;
+    }
+
+    T& elemento(std::size_t indice) {
+        return *std::launder(reinterpret_cast<T*>(almacen) + indice);
+    }
+
+    const T& elemento(std::size_t indice) const {
+        return *std::launder(reinterpret_cast<const T*>(almacen) + indice);
+    }
+
+    // Construye un elemento al final; el nodo no debe estar lleno
+    template <typename... Args>
+    T& emplazar(Args&&... args) {
+        T* nuevo = ::new (static_cast<void*>(reinterpret_cast<T*>(almacen) + cantidad)) T(std::forward<Args>(args)...);
+        cantidad++;
+        return *nuevo;
+    }
+
+private:
+    alignas(T) unsigned char almacen[N * sizeof(T)];  // Espacio para N elementos
+};
+
+// Enlaces que el Garbage Collector recorre para detectar los ciclos siguiente/anterior
+template <typename T, std::size_t N>
+struct TrazadoMPointer<NodoDesenrollado<T, N>> {
+    static constexpr bool tieneReferencias = true;
+
+    static void trazar(const NodoDesenrollado<T, N>& nodo, const VisitanteGC& visitar) {
+        visitar(nodo.siguiente);
+        visitar(nodo.anterior);
+    }
+};
+
+// Lista doblemente enlazada con varios elementos por nodo
+// Qué sucede: Cada nodo guarda un arreglo de hasta N elementos; `agregar` llena el último nodo antes
+// de crear otro.
+// Por qué sucede: Con T pequeño, ListaDoble paga un salto de puntero y un bloque de control por
+// elemento; aquí se pagan una vez cada N elementos y el recorrido lee memoria contigua.
+// Qué deberíamos esperar: La misma interfaz que ListaDoble más iteradores bidireccionales, que no
+// se invalidan al agregar (salvo los de una lista vacía). Los algoritmos de sorting.h tienen
+// sobrecargas para esta lista.
+template <typename T, std::size_t N = capacidadDesenrollada<T>()>
+class ListaDesenrollada {
+    static_assert(N > 0, "Un nodo debe tener lugar para al menos un elemento");
+
+public:
+    using Nodo = NodoDesenrollado<T, N>;
+
+    // Iterador bidireccional sobre los elementos, sin tocar contadores de referencias
+    // `Valor` es T o const T. El final es la posición siguiente al último elemento del último nodo; si
+    // después `agregar` llena ese nodo o le engancha otro, la misma posición pasa a designar el primer
+    // elemento agregado, así que un end() anterior deja de ser el final pero no queda inválido.
+    template <typename Valor>
+    class Iterador {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Valor*;
+        using reference = Valor&;
+
+        Iterador() = default;
+        Iterador(Nodo* nodo, std::size_t indice) : nodo(nodo), indice(indice) {}
+
+        // Un iterador común se convierte en uno constante
+        template <typename Otro, typename = std::enable_if_t<std::is_const<Valor>::value && std::is_same<Otro, T>::value>>
+        Iterador(const Iterador<Otro>& otro) : nodo(otro.nodo), indice(otro.indice) {}
+
+        reference operator*() const {
+            Iterador real = normalizado();
+            return real.nodo->elemento(real.indice);
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        Iterador& operator++() {
+            *this = normalizado();
+            if (++indice == nodo->cantidad && nodo->siguiente != nullptr) {
+                nodo = MPointerVista<Nodo>(nodo->siguiente).get();
+                indice = 0;
+            }
+            return *this;
+        }
+
+        Iterador operator++(int) {
+            Iterador anterior = *this;
+            ++*this;
+            return anterior;
+        }
+
+        Iterador& operator--() {
+            if (indice == 0) {
+                nodo = MPointerVista<Nodo>(nodo->anterior).get();
+                indice = nodo->cantidad;
+            }
+            indice--;
+            return *this;
+        }
+
+        Iterador operator--(int) {
+            Iterador siguiente = *this;
+            --*this;
+            return siguiente;
+        }
+
+        bool operator==(const Iterador& otro) const {
+            if (nodo == otro.nodo && indice == otro.indice) {
+                return true;
+            }
+            Iterador real = normalizado();
+            Iterador otroReal = otro.normalizado();
+            return real.nodo == otroReal.nodo && real.indice == otroReal.indice;
+        }
+
+        bool operator!=(const Iterador& otro) const {
+            return !(*this == otro);
+        }
+
+    private:
+        template <typename>
+        friend class Iterador;
+
+        // La misma posición, pasada al principio del siguiente nodo si quedó al final de uno que ya
+        // no es el último (un iterador que estaba en end() antes de un `agregar`)
+        Iterador normalizado() const {
+            if (nodo != nullptr && indice == nodo->cantidad && nodo->siguiente != nullptr) {
+                return Iterador(MPointerVista<Nodo>(nodo->siguiente).get(), 0);
+            }
+            return *this;
+        }
+
+        Nodo* nodo = nullptr;
+        std::size_t indice = 0;
+    };
+
+    using iterator = Iterador<T>;
+    using const_iterator = Iterador<const T>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr std::size_t capacidadNodo = N;
+
+private:
+    MPointer<Nodo> head;  // Puntero al primer nodo de la lista
+    MPointer<Nodo> tail;  // Puntero al último nodo de la lista
+    std::size_t elementos;  // Cantidad total de elementos
+
+public:
+    // Constructor por defecto
+    // Qué sucede: Inicializa los punteros `head` y `tail` a nullptr.
+    // Por qué sucede: La lista se crea vacía, por lo que no hay nodos.
+    // Qué deberíamos esperar: Tanto `head` como `tail` estarán en nullptr.
+    ListaDesenrollada() : head(nullptr), tail(nullptr), elementos(0) {}
+
+    // Método para agregar un elemento al final de la lista
+    // Qué sucede: Construye el valor en el último nodo, o en uno nuevo si el último está lleno.
+    // Por qué sucede: Solo se reserva memoria (y se registra un objeto en el GC) cada N elementos.
+    // Qué deberíamos esperar: El valor queda último y los iteradores existentes siguen siendo válidos;
+    // un end() tomado antes designa ahora el valor agregado.
+    void agregar(T valor) {
+        if (tail == nullptr || tail->lleno()) {
+            MPointer<Nodo> nuevoNodo = MPointer<Nodo>::New();
+            if (head == nullptr) {
+                head = nuevoNodo;
+            } else {
+                tail->siguiente = nuevoNodo;
+                nuevoNodo->anterior = std::move(tail);
+            }
+            tail = std::move(nuevoNodo);
+        }
+        tail->emplazar(std::move(valor));
+        elementos++;
+    }
+
+    // Método para imprimir la lista
+    // Qué sucede: Recorre los elementos en orden e imprime cada uno.
+    // Por qué sucede: Permite ver los valores almacenados en la lista.
+    // Qué deberíamos esperar: Se imprimen los valores de todos los elementos en orden.
+    void imprimir() const {
+        for (const T& valor : *this) {
+            std::cout << valor << " ";
+        }
+        std::cout << std::endl;
+    }
+
+    // Método para ordenar la lista con MergeSort
+    // Qué sucede: Ordena los elementos de forma estable con `mergeSort` de sorting.h.
+    // Por qué sucede: Los nodos no se reenlazan: los elementos se mueven entre las posiciones fijas.
+    // Qué deberíamos esperar: Los elementos quedan en orden ascendente, sin cambiar de nodo su cantidad.
+    void ordenarMerge() {
+        mergeSort(*this);
+    }
+
+    // Cantidad de elementos
+    std::size_t tamano() const {
+        return elementos;
+    }
+
+    bool vacia() const {
+        return elementos == 0;
+    }
+
+    // Método para obtener el primer nodo (head)
+    // Qué sucede: Devuelve el puntero al primer nodo de la lista.
+    // Por qué sucede: Permite acceder al inicio de la lista.
+    // Qué deberíamos esperar: Devuelve una referencia a `head`, sin copiarlo.
+    const MPointer<Nodo>& obtenerHead() const {
+        return head;
+    }
+
+    // Método para obtener el último nodo (tail)
+    // Qué sucede: Devuelve el puntero al último nodo de la lista.
+    // Por qué sucede: Permite acceder al final de la lista.
+    // Qué deberíamos esperar: Devuelve una referencia a `tail`, sin copiarlo.
+    const MPointer<Nodo>& obtenerTail() const {
+        return tail;
+    }
+
+    // Iteradores al primer elemento y a la posición siguiente al último
+    iterator begin() {
+        return iterator(primerNodo(), 0);
+    }
+
+    iterator end() {
+        return iterator(ultimoNodo(), finalUltimo());
+    }
+
+    const_iterator begin() const {
+        return const_iterator(primerNodo(), 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(ultimoNodo(), finalUltimo());
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+private:
+    Nodo* primerNodo() const {
+        return MPointerVista<Nodo>(head).get();
+    }
+
+    Nodo* ultimoNodo() const {
+        return MPointerVista<Nodo>(tail).get();
+    }
+
+    std::size_t finalUltimo() const {
+        return tail == nullptr ? 0 : tail->cantidad;
+    }
+};
+
+#endif
@@ -1,36 +1,462 @@
 #ifndef LISTADOBLE_H
 #define LISTADOBLE_H
 
-#include "Nodo.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "IndiceLista.h"
+#include "sorting.h"
 
-template <typename T>
+// Con PoliticaIntrusiva, cada nodo lleva su contador y sus enlaces son punteros simples: menos
+// memoria por nodo y recorridos más rápidos. Los nodos intrusivos salen siempre de la arena de su tipo.
+template <typename T, typename Politica = PoliticaPorDefecto>
 class ListaDoble {
 private:
-    MPointer<Nodo<T>> head;  // Puntero al primer nodo de la lista
-    MPointer<Nodo<T>> tail;  // Puntero al último nodo de la lista
+    using Enlace = EnlaceNodo<T, Politica>;
+    using NodoLista = Nodo<T, Politica>;
+
+public:
+    // Iterador bidireccional sobre los valores, sin tocar contadores de referencias
+    // Qué sucede: Guarda un puntero crudo al nodo actual y avanza leyendo `siguiente`/`anterior`.
+    // Por qué sucede: Recorrer con MPointer copiaría un enlace por paso; el iterador es un puntero.
+    // Qué deberíamos esperar: Funciona con range-for y <algorithm>. `Valor` es T o const T. El final es
+    // un nodo nulo; retroceder desde él lleva al `tail` actual de la lista. Es válido mientras la lista
+    // mantenga vivo el nodo (agregar no invalida iteradores; ordenar con MergeSort sí cambia su orden).
+    template <typename Valor>
+    class Iterador {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Valor*;
+        using reference = Valor&;
+
+        Iterador() = default;
+        Iterador(NodoLista* nodo, const Enlace* cola) : nodo(nodo), cola(cola) {}
+
+        // Un iterador común se convierte en uno constante
+        template <typename Otro, typename = std::enable_if_t<std::is_const<Valor>::value && std::is_same<Otro, T>::value>>
+        Iterador(const Iterador<Otro>& otro) : nodo(otro.nodo), cola(otro.cola) {}
+
+        reference operator*() const {
+            return nodo->data;
+        }
+
+        pointer operator->() const {
+            return &nodo->data;
+        }
+
+        Iterador& operator++() {
+            nodo = VistaNodo<T, Politica>(nodo->siguiente).get();
+            return *this;
+        }
+
+        Iterador operator++(int) {
+            Iterador anterior = *this;
+            ++*this;
+            return anterior;
+        }
+
+        Iterador& operator--() {
+            nodo = nodo == nullptr ? VistaNodo<T, Politica>(*cola).get() : VistaNodo<T, Politica>(nodo->anterior).get();
+            return *this;
+        }
+
+        Iterador operator--(int) {
+            Iterador siguiente = *this;
+            --*this;
+            return siguiente;
+        }
+
+        bool operator==(const Iterador& otro) const {
+            return nodo == otro.nodo;
+        }
+
+        bool operator!=(const Iterador& otro) const {
+            return nodo != otro.nodo;
+        }
+
+    private:
+        template <typename>
+        friend class Iterador;
+
+        NodoLista* nodo = nullptr;  // Nodo actual, o nullptr al final
+        const Enlace* cola = nullptr;  // `tail` de la lista, para retroceder desde el final
+    };
+
+    using iterator = Iterador<T>;
+    using const_iterator = Iterador<const T>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    // Lo que comparten las copias de una lista junto con su cadena de nodos
+    struct EstadoCompartido {
+        std::size_t cantidad = 0;  // Nodos de la cadena
+        std::uint64_t version = 0;  // Cambia con cada modificación de la cadena, desde cualquier copia
+    };
+
+    Enlace head;  // Puntero al primer nodo de la lista
+    Enlace tail;  // Puntero al último nodo de la lista
+    ArenaBloques* arena;  // Memoria de donde salen los nodos (sin uso con nodos intrusivos)
+    MPointer<EstadoCompartido, PoliticaLocal> estado;  // Se crea con el primer nodo; nullptr en una lista vacía
+    IndiceLista<T, Politica> indice;  // Índice posicional, construido recién cuando se lo necesita
+    std::uint64_t versionIndice = 0;  // Versión de la cadena que refleja `indice`
+
+    template <typename... Args>
+    Enlace crearNodo(Args&&... args) {
+        if constexpr (Politica::intrusivo) {
+            return Enlace::New(std::forward<Args>(args)...);
+        } else {
+            return Enlace::NewEn(arena, std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename Iterador>
+    std::vector<Enlace> crearLote(Iterador primero, Iterador ultimo) {
+        if constexpr (Politica::intrusivo) {
+            return Enlace::NewLote(primero, ultimo);
+        } else {
+            return Enlace::NewLoteEn(arena, primero, ultimo);
+        }
+    }
+
+    // Versión actual de la cadena (0 mientras la lista no tuvo nodos)
+    std::uint64_t versionActual() const {
+        return estado == nullptr ? 0 : estado->version;
+    }
+
+    // Indica si el índice está construido y ninguna copia cambió la cadena desde entonces
+    bool indiceAlDia() const {
+        return indice.vigente() && versionIndice == versionActual();
+    }
+
+    // Índice al día con la lista, construido en O(n) si se invalidó o si otra copia cambió la cadena
+    IndiceLista<T, Politica>& indiceVigente() {
+        if (!indiceAlDia()) {
+            indice.construir(VistaNodo<T, Politica>(head).get());
+            versionIndice = versionActual();
+        }
+        return indice;
+    }
+
+    // Crea el estado compartido antes de enlazar el primer nodo
+    void prepararEstado() {
+        if (estado == nullptr) {
+            estado = MPointer<EstadoCompartido, PoliticaLocal>::New();
+        }
+    }
+
+    // Registra un cambio de la cadena que suma `diferencia` nodos; con `indiceActualizado`, esta lista
+    // ya llevó el cambio a su índice y lo sigue usando, y las demás copias reconstruyen el suyo
+    void modificada(std::ptrdiff_t diferencia, bool indiceActualizado) {
+        if (estado == nullptr) {
+            return;  // Lista vacía que nunca tuvo nodos: no cambió nada.
+        }
+        estado->cantidad += diferencia;
+        estado->version++;
+        if (indiceActualizado) {
+            versionIndice = estado->version;
+        }
+    }
+
+    // Enlace que apunta a `nodo` desde la izquierda: el `siguiente` de su anterior, o `head`
+    Enlace& enlaceHacia(NodoLista* nodo) {
+        return nodo->anterior == nullptr ? head : VistaNodo<T, Politica>(nodo->anterior)->siguiente;
+    }
+
+    // Suelta los nodos de los que la lista es la única dueña, de a uno y sin recursión
+    // Qué sucede: Avanza por `head` tomando el `siguiente` de cada nodo antes de soltarlo, así que
+    // cada nodo muere sin enlaces hacia adelante y su destructor no encadena el del próximo.
+    // Por qué sucede: Con `anterior` débil, soltar `head` destruiría el primer nodo, cuyo `siguiente`
+    // destruiría el segundo, y así: una recursión de n niveles que desborda la pila en listas grandes.
+    // Qué deberíamos esperar: O(n), sin el GC. Se detiene en el primer nodo que alguien más retiene (una
+    // copia de la lista o un MPointer externo), que sigue vivo con el resto de la cadena.
+    // Con `anterior` fuerte los nodos forman ciclos que libera el GC, así que no se hace nada.
+    void liberarNodos() {
+        if constexpr (Politica::anteriorDebil) {
+            indice.invalidar();
+            tail = nullptr;
+            while (head != nullptr && head.useCount() == 1) {
+                Enlace siguiente = std::move(head->siguiente);
+                head = std::move(siguiente);  // El nodo soltado ya no tiene `siguiente`.
+            }
+            head = nullptr;
+        }
+    }
+
+    // Nodos que agregarRango crea y registra juntos; un lote chico sigue en la caché L1 entre pasada y pasada
+    static constexpr std::size_t NODOS_POR_LOTE = 32;
+
+    // Engancha al final nodos recién creados, en orden
+    void enlazarLote(std::vector<Enlace> nodos) {
+        if (nodos.empty()) {
+            return;
+        }
+        prepararEstado();
+        indice.invalidar();  // Más barato reconstruirlo una vez que actualizarlo por cada nodo.
+        const std::ptrdiff_t agregados = static_cast<std::ptrdiff_t>(nodos.size());
+        if (head == nullptr) {
+            head = nodos.front();
+        } else {
+            tail->siguiente = nodos.front();
+            nodos.front()->anterior = std::move(tail);
+        }
+        // Cada nodo toma la referencia del vector a su anterior, así que solo se cuenta `siguiente`.
+        for (std::size_t i = 1; i < nodos.size(); i++) {
+            nodos[i - 1]->siguiente = nodos[i];
+            nodos[i]->anterior = std::move(nodos[i - 1]);
+        }
+        tail = std::move(nodos.back());
+        modificada(agregados, false);
+    }
 
 public:
     // Constructor por defecto
     // Qué sucede: Inicializa los punteros `head` y `tail` a nullptr.
     // Por qué sucede: La lista se crea vacía, por lo que no hay nodos.
     // Qué deberíamos esperar: Tanto `head` como `tail` estarán en nullptr.
-    ListaDoble() : head(nullptr), tail(nullptr) {}
+    ListaDoble() : head(nullptr), tail(nullptr), arena(nullptr) {
+        if constexpr (!Politica::intrusivo) {
+            arena = BloqueEnLinea<Nodo<T, Politica>>::arenaPorDefecto();
+        }
+    }
+
+    // Constructor con una arena propia
+    // Qué sucede: Los nodos se reservan en `arena`; con nullptr, cada uno con `new` global.
+    // Por qué sucede: Una arena propia mantiene juntos los nodos de esta lista aunque otras crezcan a la vez.
+    // Qué deberíamos esperar: La arena debe sobrevivir a los nodos de la lista.
+    explicit ListaDoble(ArenaBloques* arena) : head(nullptr), tail(nullptr), arena(arena) {
+        static_assert(!Politica::intrusivo, "Los nodos intrusivos se reservan en la arena de su tipo");
+    }
+
+    // Constructor a partir de un rango
+    // Qué sucede: Crea la lista con una copia de cada elemento de [primero, ultimo), en orden.
+    // Por qué sucede: Construir desde un búfer existente no debería pagar un `agregar` por elemento.
+    // Qué deberíamos esperar: Lo mismo que `agregarRango` sobre una lista vacía.
+    template <typename Iterador, typename = typename std::iterator_traits<Iterador>::iterator_category>
+    ListaDoble(Iterador primero, Iterador ultimo) : ListaDoble() {
+        agregarRango(primero, ultimo);
+    }
+
+    // Constructor a partir de una lista de valores, por ejemplo `ListaDoble<int> lista{3, 1, 2}`
+    ListaDoble(std::initializer_list<T> valores) : ListaDoble(valores.begin(), valores.end()) {}
+
+    // Constructor de copia
+    // Qué sucede: La copia comparte con el original los nodos, como siempre, y también la cantidad y la
+    // versión de la cadena; empieza sin índice.
+    // Por qué sucede: El índice guarda punteros crudos a los nodos y cada lista mantiene el suyo. Cada
+    // cambio de la cadena, desde cualquier copia, sube la versión compartida.
+    // Qué deberíamos esperar: Una copia cuyo índice quedó atrás de la versión lo reconstruye en el
+    // próximo `at`, `insertarEn`, `eliminarEn` o `lower_bound`; `tamano` ve el cambio enseguida. Como
+    // siempre, `head` y `tail` son de cada copia: cambiar los extremos a través de una no mueve los de
+    // las demás.
+    ListaDoble(const ListaDoble& other)
+        : head(other.head), tail(other.tail), arena(other.arena), estado(other.estado) {}
+
+    // Constructor de movimiento
+    // El índice se lleva con los nodos; el original queda vacío y sin índice, como tras la asignación.
+    ListaDoble(ListaDoble&& other)
+        : head(std::move(other.head)), tail(std::move(other.tail)), arena(other.arena), estado(std::move(other.estado)),
+          indice(std::move(other.indice)), versionIndice(other.versionIndice) {
+        other.indice.invalidar();
+    }
+
+    // Asignación por copia, con la misma semántica que el constructor de copia
+    ListaDoble& operator=(const ListaDoble& other) {
+        if (this != std::addressof(other)) {
+            ListaDoble copia(other);
+            *this = std::move(copia);
+        }
+        return *this;
+    }
+
+    ListaDoble& operator=(ListaDoble&& other) {
+        if (this != std::addressof(other)) {
+            liberarNodos();
+            head = std::move(other.head);
+            tail = std::move(other.tail);
+            arena = other.arena;
+            estado = std::move(other.estado);
+            indice = std::move(other.indice);
+            versionIndice = other.versionIndice;
+            other.indice.invalidar();
+        }
+        return *this;
+    }
+
+    // Destructor
+    // Qué sucede: Con PoliticaAnteriorDebil suelta los nodos de a uno (ver liberarNodos).
+    // Por qué sucede: Sin ciclos, el conteo de referencias alcanza para liberar la lista en el momento.
+    // Qué deberíamos esperar: Con `anterior` débil, la memoria de los nodos vuelve en O(n) sin pasar
+    // por el GC ni crecer la pila; con `anterior` fuerte, los nodos quedan para el GC, como siempre.
+    ~ListaDoble() {
+        liberarNodos();
+    }
 
     // Método para agregar un nuevo nodo al final de la lista
     // Qué sucede: Crea un nuevo nodo con el valor proporcionado y lo añade al final de la lista.
     // Por qué sucede: Permite añadir elementos a una lista doblemente enlazada.
     // Qué deberíamos esperar: El nuevo nodo se convierte en el nuevo `tail` de la lista.
     void agregar(T valor) {
-        MPointer<Nodo<T>> nuevoNodo = MPointer<Nodo<T>>::New();  // Crea un nuevo nodo.
-        nuevoNodo->data = valor;  // Asigna el valor al nuevo nodo.
+        emplazar(std::move(valor));
+    }
+
+    // Método para construir un valor al final de la lista
+    // Qué sucede: Crea un nodo cuyo valor se construye en el lugar con `args`, sin copias intermedias.
+    // Por qué sucede: Evita construir un T temporal para copiarlo o moverlo dentro del nodo.
+    // Qué deberíamos esperar: Devuelve una referencia al valor nuevo, que queda en `tail`.
+    template <typename... Args>
+    T& emplazar(Args&&... args) {
+        prepararEstado();
+        Enlace nuevoNodo = crearNodo(std::in_place, std::forward<Args>(args)...);  // Crea el nodo con su valor en una sola reserva.
 
         if (head == nullptr) {  // Si la lista está vacía.
             head = nuevoNodo;  // El nuevo nodo es el primero.
-            tail = nuevoNodo;  // El nuevo nodo también es el último.
+            tail = std::move(nuevoNodo);  // El nuevo nodo también es el último.
         } else {
             tail->siguiente = nuevoNodo;  // El último nodo apunta al nuevo nodo.
-            nuevoNodo->anterior = tail;  // El nuevo nodo apunta hacia atrás al antiguo último nodo.
-            tail = nuevoNodo;  // El nuevo nodo se convierte en el último de la lista.
+            nuevoNodo->anterior = std::move(tail);  // El nuevo nodo toma la referencia al antiguo último nodo.
+            tail = std::move(nuevoNodo);  // El nuevo nodo se convierte en el último de la lista.
+        }
+        const bool actualizar = indiceAlDia();
+        if (actualizar) {  // El índice, si existe, se actualiza en O(log n).
+            indice.insertado(indice.tamano(), VistaNodo<T, Politica>(tail).get());
+        }
+        modificada(1, actualizar);
+        return tail->data;
+    }
+
+    // Método para construir un valor en una posición
+    // Qué sucede: Busca con el índice el nodo de la posición `posicion` y engancha el nuevo antes que él
+    // (al final si `posicion` es el tamaño de la lista).
+    // Por qué sucede: El índice llega a la posición en O(log n) en vez de recorrer `posicion` enlaces.
+    // Qué deberíamos esperar: El valor nuevo queda en `posicion` y los siguientes se corren uno.
+    // Lanza std::out_of_range si `posicion` es mayor que el tamaño.
+    template <typename... Args>
+    T& insertarEn(std::size_t posicion, Args&&... args) {
+        IndiceLista<T, Politica>& vigente = indiceVigente();
+        if (posicion > vigente.tamano()) {
+            throw std::out_of_range("ListaDoble::insertarEn: posición fuera de la lista");
+        }
+        if (posicion == vigente.tamano()) {
+            return emplazar(std::forward<Args>(args)...);
+        }
+        NodoLista* siguiente = vigente.buscar(VistaNodo<T, Politica>(head).get(), posicion);
+        Enlace nuevoNodo = crearNodo(std::in_place, std::forward<Args>(args)...);
+        Enlace& hacia = enlaceHacia(siguiente);
+        nuevoNodo->anterior = siguiente->anterior;
+        nuevoNodo->siguiente = std::move(hacia);  // Toma la referencia que el anterior tenía al siguiente.
+        siguiente->anterior = nuevoNodo;
+        NodoLista* crudo = VistaNodo<T, Politica>(nuevoNodo).get();
+        hacia = std::move(nuevoNodo);
+        vigente.insertado(posicion, crudo);
+        modificada(1, true);
+        return crudo->data;
+    }
+
+    // Método para quitar el valor de una posición
+    // Qué sucede: Busca el nodo con el índice, lo desenlaza y corta sus propios enlaces.
+    // Por qué sucede: Sin enlaces hacia sus vecinos, el nodo se libera por conteo de referencias, sin el GC.
+    // Qué deberíamos esperar: Devuelve el valor quitado; los siguientes retroceden una posición.
+    // Lanza std::out_of_range si `posicion` no es menor que el tamaño.
+    T eliminarEn(std::size_t posicion) {
+        IndiceLista<T, Politica>& vigente = indiceVigente();
+        if (posicion >= vigente.tamano()) {
+            throw std::out_of_range("ListaDoble::eliminarEn: posición fuera de la lista");
+        }
+        NodoLista* nodo = vigente.buscar(VistaNodo<T, Politica>(head).get(), posicion);
+        vigente.eliminado(posicion);
+        modificada(-1, true);
+        Enlace& desdeAnterior = enlaceHacia(nodo);
+        Enlace retenido = desdeAnterior;  // Mantiene vivo el nodo mientras se reenlazan sus vecinos.
+        desdeAnterior = nodo->siguiente;
+        if (nodo->siguiente == nullptr) {
+            tail = Enlace(VistaNodo<T, Politica>(nodo->anterior));  // `tail` es fuerte aunque `anterior` sea débil.
+        } else {
+            nodo->siguiente->anterior = nodo->anterior;
+        }
+        nodo->siguiente = nullptr;
+        nodo->anterior = nullptr;
+        return std::move(nodo->data);
+    }
+
+    // Método para acceder al valor de una posición
+    // Qué sucede: Baja por el índice hasta el nodo de la posición; el índice se construye en O(n) la
+    // primera vez (o tras un cambio desde otra copia) y después lo mantienen `agregar`, `insertarEn` y
+    // `eliminarEn`.
+    // Por qué sucede: Sin índice, llegar a la posición k cuesta recorrer k enlaces.
+    // Qué deberíamos esperar: O(log n) esperado. Lanza std::out_of_range si `posicion` no es menor que el tamaño.
+    T& at(std::size_t posicion) {
+        IndiceLista<T, Politica>& vigente = indiceVigente();
+        if (posicion >= vigente.tamano()) {
+            throw std::out_of_range("ListaDoble::at: posición fuera de la lista");
+        }
+        return vigente.buscar(VistaNodo<T, Politica>(head).get(), posicion)->data;
+    }
+
+    // Método para buscar en una lista ordenada
+    // Qué sucede: Baja por el índice comparando con los nodos indexados y termina a menos de un salto.
+    // Por qué sucede: En una lista ordenada los niveles del índice también lo están.
+    // Qué deberíamos esperar: El primer valor no menor que `valor` según `menor`, o end(), en O(log n)
+    // esperado. La lista debe estar ordenada con el mismo criterio.
+    template <typename Comparador = std::less<T>>
+    iterator lower_bound(const T& valor, Comparador menor = Comparador()) {
+        NodoLista* nodo = indiceVigente().cotaInferior(VistaNodo<T, Politica>(head).get(), valor, menor);
+        return iterator(nodo, std::addressof(tail));
+    }
+
+    // Cantidad de valores de la lista, en O(1), compartida con sus copias
+    std::size_t tamano() const {
+        return estado == nullptr ? 0 : estado->cantidad;
+    }
+
+    // Descarta el índice posicional y vuelve a contar los nodos desde `head`, en O(n)
+    // Hace falta después de cambiar los enlaces de los nodos por fuera de la lista, por ejemplo a través
+    // de obtenerHead(); los métodos de la lista y de sus copias mantienen el índice y la cantidad solos.
+    // Las copias también reconstruyen su índice en el próximo uso.
+    void invalidarIndice() {
+        indice.invalidar();
+        std::size_t cantidad = 0;
+        for (VistaNodo<T, Politica> actual = head; actual != nullptr; actual = actual->siguiente) {
+            cantidad++;
+        }
+        if (estado != nullptr) {
+            modificada(static_cast<std::ptrdiff_t>(cantidad) - static_cast<std::ptrdiff_t>(estado->cantidad), false);
+        }
+    }
+
+    // Método para agregar un rango de valores al final de la lista
+    // Qué sucede: Crea todos los nodos con MPointer::NewLote (una reserva en lote en la arena y un solo
+    // registro en el GC) y los enlaza entre sí antes de engancharlos a `tail`.
+    // Por qué sucede: Con `agregar`, cada elemento toma el candado de la arena y el del registro, y
+    // reasigna `tail` contando referencias.
+    // Qué deberíamos esperar: Los valores quedan al final en el orden del rango. Con iteradores de una
+    // sola pasada, los valores se copian primero a un búfer para poder contarlos.
+    template <typename Iterador>
+    void agregarRango(Iterador primero, Iterador ultimo) {
+        using Categoria = typename std::iterator_traits<Iterador>::iterator_category;
+        if constexpr (!std::is_base_of<std::forward_iterator_tag, Categoria>::value) {
+            std::vector<T> valores(primero, ultimo);
+            agregarRango(std::make_move_iterator(valores.begin()), std::make_move_iterator(valores.end()));
+        } else {
+            // Por lotes de NODOS_POR_LOTE: cada lote se crea, registra y enlaza mientras sigue en caché.
+            while (primero != ultimo) {
+                Iterador finLote = primero;
+                std::size_t cantidad = 0;
+                for (; finLote != ultimo && cantidad < NODOS_POR_LOTE; ++finLote) {
+                    cantidad++;
+                }
+                enlazarLote(crearLote(primero, finLote));
+                primero = finLote;
+            }
         }
     }
 
@@ -39,7 +465,7 @@ public:
     // Por qué sucede: Permite ver los valores almacenados en la lista.
     // Qué deberíamos esperar: Se imprimen los valores de todos los nodos en orden.
     void imprimir() {
-        MPointer<Nodo<T>> actual = head;  // Comienza desde el primer nodo.
+        VistaNodo<T, Politica> actual = head;  // Comienza desde el primer nodo, sin contar referencias.
         while (actual != nullptr) {  // Mientras no se llegue al final de la lista.
             std::cout << actual->data << " ";  // Imprime el valor del nodo actual.
             actual = actual->siguiente;  // Pasa al siguiente nodo.
@@ -47,19 +473,83 @@ public:
         std::cout << std::endl;
     }
 
+    // Método para ordenar la lista con MergeSort
+    // Qué sucede: Reenlaza los nodos en orden ascendente, sin copiar sus valores ni usar recursión.
+    // Por qué sucede: Es estable, O(n log n) en cualquier entrada y no depende del tamaño de T.
+    // Qué deberíamos esperar: `head` y `tail` quedan en el menor y el mayor elemento.
+    void ordenarMerge() {
+        indice.invalidar();  // Los nodos cambian de posición.
+        mergeSort(head, tail);
+        modificada(0, false);
+    }
+
+    // Método para ordenar la lista con el algoritmo más rápido para T
+    // Qué sucede: Con enteros o flotantes usa `radixSort`, que reescribe los valores; con otros T,
+    // `mergeSort`, que reenlaza los nodos.
+    // Por qué sucede: Las claves aritméticas se ordenan sin comparaciones, en O(n).
+    // Qué deberíamos esperar: Los valores en orden ascendente, igual que con `ordenarMerge`.
+    void ordenar() {
+        indice.invalidar();
+        radixSort(head, tail);
+        modificada(0, false);
+    }
+
+    // Método para ordenar la lista en paralelo
+    // Qué sucede: Ordena tramos de la lista en los hilos de `pool` y los mezcla, como `ordenarMerge`.
+    // Por qué sucede: Reparte el trabajo de listas grandes; las de hasta `corte` nodos se ordenan en serie.
+    // Qué deberíamos esperar: El mismo resultado estable que `ordenarMerge`.
+    void ordenarParalelo(PoolTareas& pool, std::size_t corte = 1u << 14) {
+        indice.invalidar();
+        mergeSortParalelo(head, tail, pool, corte);
+        modificada(0, false);
+    }
+
+    // Iteradores al primer valor y a la posición siguiente al último
+    iterator begin() {
+        return iterator(VistaNodo<T, Politica>(head).get(), std::addressof(tail));
+    }
+
+    iterator end() {
+        return iterator(nullptr, std::addressof(tail));
+    }
+
+    const_iterator begin() const {
+        return const_iterator(VistaNodo<T, Politica>(head).get(), std::addressof(tail));
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr, std::addressof(tail));
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
     // Método para obtener el primer nodo (head)
     // Qué sucede: Devuelve el puntero al primer nodo de la lista.
     // Por qué sucede: Permite acceder al inicio de la lista.
-    // Qué deberíamos esperar: Devuelve `head`.
-    MPointer<Nodo<T>> obtenerHead() {
+    // Qué deberíamos esperar: Devuelve una referencia a `head`, sin copiarlo.
+    const Enlace& obtenerHead() const {
         return head;
     }
 
     // Método para obtener el último nodo (tail)
     // Qué sucede: Devuelve el puntero al último nodo de la lista.
     // Por qué sucede: Permite acceder al final de la lista.
-    // Qué deberíamos esperar: Devuelve `tail`.
-    MPointer<Nodo<T>> obtenerTail() {
+    // Qué deberíamos esperar: Devuelve una referencia a `tail`, sin copiarlo.
+    const Enlace& obtenerTail() const {
         return tail;
     }
 };
@@ -2,78 +2,206 @@
 #define MPOINTER_H
 
 #include <iostream>
-#include "MPointerGC.h"
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "BloqueControl.h"
+
+template <typename T, typename Politica = PoliticaPorDefecto>
+class MPointerVista;
+
+template <typename T, typename Politica = PoliticaPorDefecto>
+class MWeakPointer;
+
+// Lo que guarda un MPointer: el objeto y su bloque de control
+// Con contador externo son dos punteros; con contador intrusivo el bloque es el propio objeto,
+// así que basta uno. `bloque()` solo se instancia al usarse, cuando T ya está completo.
+template <typename T, bool Intrusivo>
+struct EnlaceMPointer {
+    T* ptr = nullptr;  // Objeto gestionado
+    BloqueControl* control = nullptr;  // Contador de referencias y handle del GC, compartidos entre copias
+
+    EnlaceMPointer() = default;
+    EnlaceMPointer(T* objeto, BloqueControl* bloque) : ptr(objeto), control(bloque) {}
+
+    BloqueControl* bloque() const {
+        return control;
+    }
+};
 
 template <typename T>
+struct EnlaceMPointer<T, true> {
+    T* ptr = nullptr;  // Objeto gestionado, que es también su bloque de control
+
+    EnlaceMPointer() = default;
+    EnlaceMPointer(T* objeto, BloqueControl*) : ptr(objeto) {}
+
+    BloqueControl* bloque() const {
+        return static_cast<ObjetoIntrusivo*>(ptr);
+    }
+};
+
+template <typename T, typename Politica>
 class MPointer {
+    static_assert(EsPoliticaMPointer<Politica>::value, "La política de MPointer debe ser una PoliticaMPointer");
+
 private:
-    T* ptr;  // Puntero interno que almacena el valor de tipo T
-    int id;  // Identificador único para el puntero
-    int* refCount;  // Contador de referencias compartidas para gestionar memoria
+    friend class MPointerVista<T, Politica>;
+    friend class MWeakPointer<T, Politica>;
+    friend class VisitanteGC;
+
+    using Enlace = EnlaceMPointer<T, Politica::intrusivo>;
+
+    Enlace enlace;  // Objeto y bloque de control (un solo puntero con la política intrusiva)
+
+    // Constructor a partir de un bloque recién creado
+    // Qué sucede: Toma el objeto del bloque y, si la política lo rastrea, registra el bloque en el Garbage Collector.
+    // Por qué sucede: Todos los caminos que reservan memoria terminan aquí.
+    // Qué deberíamos esperar: `ptr` apunta al objeto y el contador del bloque vale 1.
+    MPointer(T* objeto, BloqueControl* bloque) : enlace(objeto, bloque) {
+        if constexpr (Politica::rastreado) {
+            MPointerGC::verificarMutador();
+            bloque->id = MPointerGC::getInstance().registerPointer(bloque);  // Registra el bloque en el Garbage Collector.
+        }
+    }
+
+    // Constructor a partir de un bloque ya registrado en lote (o de una política no rastreada)
+    struct SinRegistrar {};
+    MPointer(T* objeto, BloqueControl* bloque, SinRegistrar) : enlace(objeto, bloque) {}
+
+    // Registra en el GC, con una sola llamada, los bloques recién creados y los envuelve en MPointers
+    template <typename ObjetoDe>
+    static std::vector<MPointer> adoptarLote(const std::vector<BloqueControl*>& bloques, ObjetoDe objetoDe) {
+        if constexpr (Politica::rastreado) {
+            MPointerGC::verificarMutador();
+            MPointerGC::getInstance().registerBatch(bloques.data(), bloques.size());
+        }
+        std::vector<MPointer> punteros;
+        punteros.reserve(bloques.size());
+        for (BloqueControl* bloque : bloques) {
+            punteros.push_back(MPointer(objetoDe(bloque), bloque, SinRegistrar{}));
+        }
+        return punteros;
+    }
+
+    // Constructor a partir de un bloque con el objeto en línea
+    explicit MPointer(BloqueEnLinea<T>* bloque) : MPointer(bloque->objeto(), bloque) {}
+
+    // Suelta la referencia actual
+    // Qué sucede: Decrementa el contador y, si llega a 0, desregistra el bloque y libera el objeto.
+    // Por qué sucede: El destructor y la asignación comparten esta lógica.
+    // Qué deberíamos esperar: La memoria se libera una sola vez, cuando muere la última referencia.
+    // Un objeto joven que muere sin haber sido promovido no tiene handle y no toca el registro.
+    void soltar() {
+        BloqueControl* control = enlace.bloque();
+        if (control == nullptr) {
+            return;
+        }
+        verificarMutador();
+        if (control->template soltarReferencia<Politica::atomico>()) {
+            if constexpr (Politica::rastreado) {
+                if (control->id != MPointerGC::HANDLE_INVALIDO) {
+                    MPointerGC::getInstance().deregisterPointer(control->id);  // Desregistra el puntero del Garbage Collector.
+                }
+            }
+            control->template destruir<Politica::atomico>();  // Destruye el objeto y libera el bloque si no hay débiles.
+        }
+    }
+
+    // Suma una referencia al objeto actual, si hay uno
+    void retener() const {
+        BloqueControl* control = enlace.bloque();
+        if (control != nullptr) {
+            verificarMutador();
+            control->template retener<Politica::atomico>();
+        }
+    }
+
+    // Con una política rastreada, comprueba que el hilo pueda cambiar contadores (MPointerGC::verificarMutador)
+    static void verificarMutador() noexcept {
+        if constexpr (Politica::rastreado) {
+            MPointerGC::verificarMutador();
+        }
+    }
 
 public:
     // Constructor por defecto
-    // Qué sucede: Se inicializa el puntero interno `ptr` con una nueva instancia del tipo T.
-    // Por qué sucede: Se asigna memoria dinámica al puntero y se registra en el Garbage Collector.
-    // Qué deberíamos esperar: El puntero `ptr` apunta a un nuevo objeto de tipo T, y `refCount` se inicializa en 1.
-    MPointer() {
-        ptr = new T();  // Asigna memoria dinámica para un nuevo objeto de tipo T.
-        refCount = new int(1);  // Inicializa el contador de referencias a 1.
-        id = MPointerGC::getInstance().registerPointer(this);  // Registra el puntero en el Garbage Collector.
+    // Qué sucede: Construye una nueva instancia del tipo T dentro de un bloque de control.
+    // Por qué sucede: El objeto, su contador y su handle se reservan juntos y se registran en el Garbage Collector.
+    // Qué deberíamos esperar: El puntero `ptr` apunta a un nuevo objeto de tipo T, y el contador se inicializa en 1.
+    MPointer() : MPointer(New()) {}
+
+    // Constructor que adopta un objeto reservado por separado
+    // Qué sucede: Crea un bloque de control aparte para un objeto obtenido con `new T`.
+    // Por qué sucede: Permite gestionar objetos que no se crearon con `New`, a costa de una reserva extra.
+    // Qué deberíamos esperar: El `MPointer` pasa a ser dueño de `crudo` y lo libera con `delete`.
+    explicit MPointer(T* crudo) : MPointer(crudo, BloqueExterno<T>::crear(crudo)) {
+        static_assert(!Politica::intrusivo, "Un MPointer intrusivo no puede adoptar un objeto creado con new: usar New");
     }
 
     // Constructor para nullptr
-    // Qué sucede: Inicializa el puntero interno a `nullptr` y el contador de referencias a 0.
+    // Qué sucede: Inicializa el puntero interno y el bloque de control a `nullptr`.
     // Por qué sucede: Permite crear un `MPointer` que no apunta a ninguna memoria válida.
-    // Qué deberíamos esperar: `ptr` es nullptr, y el `refCount` se establece en 0.
-    MPointer(std::nullptr_t) : ptr(nullptr), refCount(new int(0)), id(-1) {}
+    // Qué deberíamos esperar: `ptr` es nullptr y no se reserva memoria.
+    MPointer(std::nullptr_t) {}
 
     // Constructor de copia
-    // Qué sucede: Copia el puntero interno y el contador de referencias de otro `MPointer`.
+    // Qué sucede: Copia el puntero interno y el bloque de control de otro `MPointer`.
     // Por qué sucede: Permite compartir la misma memoria entre múltiples `MPointer`, incrementando el contador de referencias.
-    // Qué deberíamos esperar: Tanto el nuevo `MPointer` como el original apuntan al mismo objeto, y `refCount` se incrementa.
-    MPointer(const MPointer<T>& other) {
-        ptr = other.ptr;  // Copia el puntero interno.
-        refCount = other.refCount;  // Copia el contador de referencias.
-        (*refCount)++;  // Incrementa el contador de referencias.
-        id = other.id;  // Copia el ID.
+    // Qué deberíamos esperar: Tanto el nuevo `MPointer` como el original apuntan al mismo objeto, y el contador se incrementa.
+    MPointer(const MPointer& other) : enlace(other.enlace) {
+        retener();  // Incrementa el contador de referencias.
+    }
+
+    // Constructor de movimiento
+    // Qué sucede: Toma el puntero interno y el bloque de control de `other`, que queda en nullptr.
+    // Por qué sucede: Transferir la propiedad no necesita tocar el contador de referencias.
+    // Qué deberíamos esperar: El contador no cambia y `other` queda nulo.
+    MPointer(MPointer&& other) noexcept : enlace(other.enlace) {
+        other.enlace = Enlace();
     }
 
+    // Constructor a partir de una vista
+    // Qué sucede: Convierte una referencia prestada en una referencia propia.
+    // Por qué sucede: Permite conservar un nodo encontrado durante un recorrido sin contar referencias.
+    // Qué deberíamos esperar: El contador del objeto se incrementa en 1.
+    explicit MPointer(const MPointerVista<T, Politica>& vista);
+
     // Destructor
     // Qué sucede: Decrementa el contador de referencias y libera la memoria cuando ya no es necesaria.
     // Por qué sucede: Asegura que la memoria solo se libere cuando no hay más referencias al objeto.
     // Qué deberíamos esperar: Si este es el último `MPointer` que apunta al objeto, se libera la memoria y se elimina del Garbage Collector.
     ~MPointer() {
-        (*refCount)--;  // Decrementa el contador de referencias.
-        if (*refCount == 0) {  // Si no hay más referencias, libera la memoria.
-            delete ptr;
-            delete refCount;  // Libera el contador de referencias.
-            MPointerGC::getInstance().deregisterPointer(this);  // Desregistra el puntero del Garbage Collector.
-        }
+        static_assert(!Politica::intrusivo || std::is_base_of<ObjetoIntrusivo, T>::value,
+                      "La política intrusiva requiere que T herede de ObjetoIntrusivo");
+        static_assert(Politica::intrusivo || !std::is_base_of<ObjetoIntrusivo, T>::value,
+                      "Un ObjetoIntrusivo ya tiene su contador: usar una política intrusiva");
+        soltar();
     }
 
     // Sobrecarga del operador * (dereference)
     // Qué sucede: Permite acceder al valor al que apunta el puntero `ptr`.
     // Por qué sucede: Facilita el acceso al valor gestionado por el `MPointer` como si fuera un puntero regular.
     // Qué deberíamos esperar: El valor almacenado en `ptr` se devuelve.
-    T& operator*() {
-        return *ptr;  // Devuelve el valor apuntado por `ptr`.
+    T& operator*() const {
+        return *enlace.ptr;  // Devuelve el valor apuntado por `ptr`.
     }
 
     // Sobrecarga del operador -> (acceso a miembros)
     // Qué sucede: Permite acceder a los miembros del objeto apuntado por `ptr`.
     // Por qué sucede: Facilita el acceso a los miembros del objeto gestionado por el `MPointer`.
     // Qué deberíamos esperar: Devuelve un puntero a `ptr` para acceder a sus miembros.
-    T* operator->() {
-        return ptr;  // Devuelve el puntero `ptr`.
+    T* operator->() const {
+        return enlace.ptr;  // Devuelve el puntero `ptr`.
     }
 
     // Sobrecarga del operador = (asignación con tipo T)
     // Qué sucede: Asigna un valor directo al objeto gestionado por `MPointer`.
     // Por qué sucede: Permite asignar un valor al objeto apuntado por `MPointer` como si fuera un puntero regular.
     // Qué deberíamos esperar: El valor proporcionado sobrescribe el valor almacenado en `ptr`.
-    MPointer<T>& operator=(const T& value) {
-        *ptr = value;  // Asigna el valor directamente a la memoria gestionada.
+    MPointer& operator=(const T& value) {
+        *enlace.ptr = value;  // Asigna el valor directamente a la memoria gestionada.
         return *this;  // Devuelve una referencia a sí mismo.
     }
 
@@ -81,28 +209,47 @@ public:
     // Qué sucede: Permite asignar un `MPointer` a otro, compartiendo la misma memoria.
     // Por qué sucede: Facilita la transferencia de la memoria gestionada entre `MPointer`, gestionando correctamente las referencias.
     // Qué deberíamos esperar: Ambos `MPointer` apuntan a la misma memoria y el contador de referencias se ajusta.
-    MPointer<T>& operator=(const MPointer<T>& other) {
-        if (this != &other) {  // Evita la autoasignación.
-            (*refCount)--;  // Decrementa el contador de referencias del puntero actual.
-            if (*refCount == 0) {  // Si no hay más referencias, libera la memoria.
-                delete ptr;
-                delete refCount;
-                MPointerGC::getInstance().deregisterPointer(this);  // Desregistra el puntero.
-            }
-            ptr = other.ptr;  // Asigna el nuevo puntero.
-            refCount = other.refCount;  // Copia el contador de referencias.
-            (*refCount)++;  // Incrementa el contador de referencias del nuevo puntero.
-            id = other.id;  // Copia el ID.
+    MPointer& operator=(const MPointer& other) {
+        if (enlace.ptr != other.enlace.ptr) {  // Evita la autoasignación.
+            // Se copia antes de soltar: `other` puede vivir dentro del objeto que se libera.
+            Enlace nuevo = other.enlace;
+            other.retener();  // Incrementa el contador de referencias del nuevo puntero.
+            soltar();  // Suelta la referencia actual.
+            enlace = nuevo;  // Comparte el objeto y su bloque de control.
         }
         return *this;  // Devuelve una referencia a sí mismo.
     }
 
+    // Sobrecarga del operador = (asignación por movimiento)
+    // Qué sucede: Suelta la referencia actual y toma la de `other` sin copiarla.
+    // Por qué sucede: Evita el incremento y decremento del contador al transferir un `MPointer` temporal.
+    // Qué deberíamos esperar: `other` queda nulo y el contador del nuevo objeto no cambia.
+    MPointer& operator=(MPointer&& other) noexcept {
+        if (this != std::addressof(other)) {
+            // Se vacía `other` antes de soltar: puede vivir dentro del objeto que se libera.
+            Enlace nuevo = other.enlace;
+            other.enlace = Enlace();
+            soltar();
+            enlace = nuevo;
+        }
+        return *this;
+    }
+
+    // Sobrecarga del operador = (asignación de nullptr)
+    // Qué sucede: Suelta la referencia actual y deja el puntero nulo.
+    // Por qué sucede: Permite desenlazar un objeto sin construir un `MPointer` temporal.
+    // Qué deberíamos esperar: `ptr` es nullptr y el objeto anterior se libera si era la última referencia.
+    MPointer& operator=(std::nullptr_t) {
+        MPointer anterior(std::move(*this));  // `anterior` suelta la referencia al salir de alcance.
+        return *this;
+    }
+
     // Sobrecarga del operador & (referencia)
     // Qué sucede: Permite obtener el puntero interno `ptr`.
     // Por qué sucede: Facilita el acceso directo a la memoria gestionada por el `MPointer`.
     // Qué deberíamos esperar: Devuelve el puntero `ptr`.
     T* operator&() {
-        return ptr;  // Devuelve el puntero interno `ptr`.
+        return enlace.ptr;  // Devuelve el puntero interno `ptr`.
     }
 
     // Sobrecarga del operador == para nullptr
@@ -110,7 +257,7 @@ public:
     // Por qué sucede: Facilita la comparación entre `MPointer` y `nullptr` para verificar si el puntero es nulo.
     // Qué deberíamos esperar: Devuelve `true` si `ptr` es `nullptr`, de lo contrario `false`.
     bool operator==(std::nullptr_t) const {
-        return ptr == nullptr;
+        return enlace.ptr == nullptr;
     }
 
     // Sobrecarga del operador != para nullptr
@@ -118,7 +265,7 @@ public:
     // Por qué sucede: Facilita la comparación entre `MPointer` y `nullptr` para verificar si el puntero no es nulo.
     // Qué deberíamos esperar: Devuelve `true` si `ptr` no es `nullptr`, de lo contrario `false`.
     bool operator!=(std::nullptr_t) const {
-        return ptr != nullptr;
+        return enlace.ptr != nullptr;
     }
 
     // Sobrecarga del operador == para comparar el valor apuntado con un tipo primitivo
@@ -126,7 +273,7 @@ public:
     // Por qué sucede: Facilita la comparación directa entre el valor almacenado en `ptr` y un valor de tipo `T`.
     // Qué deberíamos esperar: Devuelve `true` si los valores son iguales.
     bool operator==(const T& value) const {
-        return *ptr == value;
+        return *enlace.ptr == value;
     }
 
     // Sobrecarga del operador != para comparar el valor apuntado con un tipo primitivo
@@ -134,40 +281,302 @@ public:
     // Por qué sucede: Facilita la comparación directa entre el valor almacenado en `ptr` y un valor de tipo `T`.
     // Qué deberíamos esperar: Devuelve `true` si los valores son diferentes.
     bool operator!=(const T& value) const {
-        return *ptr != value;
+        return *enlace.ptr != value;
     }
 
     // Sobrecarga del operador == para comparar dos MPointers
     // Qué sucede: Compara si dos `MPointer` apuntan al mismo objeto.
     // Por qué sucede: Facilita la comparación entre dos `MPointer` para verificar si apuntan a la misma dirección de memoria.
     // Qué deberíamos esperar: Devuelve `true` si ambos `MPointer` apuntan al mismo objeto.
-    bool operator==(const MPointer<T>& other) const {
-        return ptr == other.ptr;
+    bool operator==(const MPointer& other) const {
+        return enlace.ptr == other.enlace.ptr;
     }
 
     // Sobrecarga del operador != para comparar dos MPointers
     // Qué sucede: Compara si dos `MPointer` no apuntan al mismo objeto.
     // Por qué sucede: Facilita la comparación entre dos `MPointer` para verificar si apuntan a direcciones de memoria diferentes.
     // Qué deberíamos esperar: Devuelve `true` si ambos `MPointer` apuntan a objetos diferentes.
-    bool operator!=(const MPointer<T>& other) const {
-        return ptr != other.ptr;
+    bool operator!=(const MPointer& other) const {
+        return enlace.ptr != other.enlace.ptr;
     }
 
     // Método estático para crear un nuevo MPointer
-    // Qué sucede: Crea un nuevo objeto `MPointer` utilizando el constructor por defecto.
-    // Por qué sucede: Facilita la creación de `MPointer` mediante un método estático.
-    // Qué deberíamos esperar: Devuelve un nuevo `MPointer`.
-    static MPointer<T> New() {
-        return MPointer<T>();  // Crea un nuevo objeto `MPointer`.
+    // Qué sucede: Construye el objeto con los argumentos dados dentro de un bloque de control.
+    // Por qué sucede: Facilita la creación de `MPointer` con una sola reserva de memoria.
+    // Qué deberíamos esperar: Devuelve un nuevo `MPointer` cuyo objeto se construyó con `args`.
+    // En el modo generacional del GC, un objeto rastreado que entra en la guardería nace joven: sin
+    // registro (getId() devuelve HANDLE_INVALIDO) hasta que sobreviva a una recolección.
+    template <typename... Args>
+    static MPointer New(Args&&... args) {
+        static_assert(!Politica::intrusivo || std::is_base_of<ObjetoIntrusivo, T>::value,
+                      "La política intrusiva requiere que T herede de ObjetoIntrusivo");
+        if constexpr (Politica::intrusivo) {
+            T* objeto = BloqueIntrusivo<T>::crear(std::forward<Args>(args)...);
+            return MPointer(objeto, objeto);  // El objeto es su propio bloque de control.
+        } else {
+            if constexpr (Politica::rastreado && BloqueEnLinea<T>::EN_GUARDERIA) {
+                if (Guarderia::activa()) {
+                    MPointerGC::verificarMutador();  // El recolector recorre la guardería.
+                    BloqueEnLinea<T>* bloque = BloqueEnLinea<T>::crearJoven(std::forward<Args>(args)...);
+                    return MPointer(bloque->objeto(), bloque, SinRegistrar{});
+                }
+            }
+            return MPointer(BloqueEnLinea<T>::crear(std::forward<Args>(args)...));
+        }
+    }
+
+    // Método estático para crear un nuevo MPointer en una arena elegida
+    // Qué sucede: Igual que `New`, pero el bloque se reserva en `arena` (con nullptr, con `new` global).
+    // Por qué sucede: Permite agrupar los objetos de una estructura en su propia memoria contigua.
+    // Qué deberíamos esperar: La arena debe sobrevivir al objeto; si no sirve para T, se usa `new`.
+    template <typename... Args>
+    static MPointer NewEn(ArenaBloques* arena, Args&&... args) {
+        static_assert(!Politica::intrusivo, "Los objetos intrusivos se reservan en la arena de su tipo: usar New");
+        return MPointer(BloqueEnLinea<T>::crearEn(arena, std::forward<Args>(args)...));
+    }
+
+    // Método estático para crear muchos MPointers a la vez
+    // Qué sucede: Construye un objeto por cada elemento de [primero, ultimo) (T(*it)), reserva toda
+    // la memoria con una sola toma de la arena y registra todos los bloques con una sola llamada al GC.
+    // Por qué sucede: En construcciones masivas, el candado de la arena y el del registro por objeto
+    // dominan el costo de `New`.
+    // Qué deberíamos esperar: Un MPointer por elemento, en el mismo orden; requiere iteradores de avance.
+    template <typename Iterador>
+    static std::vector<MPointer> NewLote(Iterador primero, Iterador ultimo) {
+        if constexpr (Politica::intrusivo) {
+            static_assert(std::is_base_of<ObjetoIntrusivo, T>::value,
+                          "La política intrusiva requiere que T herede de ObjetoIntrusivo");
+            std::vector<BloqueControl*> bloques;
+            BloqueIntrusivo<T>::crearLote(primero, static_cast<std::size_t>(std::distance(primero, ultimo)), bloques);
+            return adoptarLote(bloques, &BloqueIntrusivo<T>::objetoDe);
+        } else {
+            return NewLoteEn(BloqueEnLinea<T>::arenaPorDefecto(), primero, ultimo);
+        }
+    }
+
+    // Igual que `NewLote`, con los bloques en `arena` (con nullptr, con `new` global)
+    template <typename Iterador>
+    static std::vector<MPointer> NewLoteEn(ArenaBloques* arena, Iterador primero, Iterador ultimo) {
+        static_assert(!Politica::intrusivo, "Los objetos intrusivos se reservan en la arena de su tipo: usar NewLote");
+        std::vector<BloqueControl*> bloques;
+        BloqueEnLinea<T>::crearLoteEn(arena, primero, static_cast<std::size_t>(std::distance(primero, ultimo)), bloques);
+        return adoptarLote(bloques, [](BloqueControl* bloque) { return static_cast<BloqueEnLinea<T>*>(bloque)->objeto(); });
     }
 
     // Método para obtener el ID del puntero gestionado
     // Qué sucede: Devuelve el identificador único asignado al puntero.
     // Por qué sucede: Facilita la obtención del ID del puntero para identificaciones únicas en el Garbage Collector.
     // Qué deberíamos esperar: Devuelve el ID asociado al puntero gestionado.
-    int getId() const {
-        return id;
+    // Con una política no rastreada, siempre HANDLE_INVALIDO.
+    MPointerGC::Handle getId() const {
+        BloqueControl* control = enlace.bloque();
+        return control != nullptr ? control->id : MPointerGC::HANDLE_INVALIDO;
+    }
+
+    // Método para obtener la cantidad de referencias al objeto
+    // Qué sucede: Devuelve el contador del bloque de control compartido.
+    // Por qué sucede: Permite verificar cuántos `MPointer` comparten el objeto.
+    // Qué deberíamos esperar: 0 para un puntero nulo, y al menos 1 en otro caso.
+    int useCount() const {
+        BloqueControl* control = enlace.bloque();
+        return control != nullptr ? control->referencias() : 0;
+    }
+};
+
+// Referencia prestada a un objeto gestionado por MPointer
+// Qué sucede: Guarda el puntero al objeto y a su bloque de control sin modificar el contador.
+// Por qué sucede: Los recorridos de listas y los algoritmos de ordenamiento solo leen los enlaces,
+// así que copiar un `MPointer` en cada paso sería trabajo inútil sobre el contador.
+// Qué deberíamos esperar: Copiar o reasignar una vista nunca toca el contador ni el Garbage Collector;
+// la vista es válida mientras algún `MPointer` mantenga vivo el objeto.
+template <typename T, typename Politica>
+class MPointerVista {
+private:
+    friend class MPointer<T, Politica>;
+
+    EnlaceMPointer<T, Politica::intrusivo> enlace;  // Objeto observado y su bloque, para poder volver a un MPointer
+
+public:
+    // Constructor para nullptr
+    MPointerVista(std::nullptr_t = nullptr) {}
+
+    // Constructor a partir de un MPointer, sin incrementar su contador
+    MPointerVista(const MPointer<T, Politica>& propietario) : enlace(propietario.enlace) {}
+
+    // Constructor a partir de un MWeakPointer, sin comprobar que el objeto siga vivo
+    // Para recorridos en los que otra referencia fuerte garantiza el objeto, como `anterior` en una lista.
+    MPointerVista(const MWeakPointer<T, Politica>& debil) : enlace(debil.enlace) {}
+
+    // Sobrecarga de los operadores de acceso
+    T& operator*() const {
+        return *enlace.ptr;
+    }
+
+    T* operator->() const {
+        return enlace.ptr;
+    }
+
+    // Devuelve el puntero observado
+    T* get() const {
+        return enlace.ptr;
+    }
+
+    // Comparaciones con nullptr, con otras vistas y con MPointers
+    bool operator==(std::nullptr_t) const {
+        return enlace.ptr == nullptr;
+    }
+
+    bool operator!=(std::nullptr_t) const {
+        return enlace.ptr != nullptr;
+    }
+
+    bool operator==(const MPointerVista& other) const {
+        return enlace.ptr == other.enlace.ptr;
+    }
+
+    bool operator!=(const MPointerVista& other) const {
+        return enlace.ptr != other.enlace.ptr;
     }
 };
 
+// Referencia débil a un objeto gestionado por MPointer
+// Qué sucede: Comparte el bloque de control del MPointer del que se crea y cuenta en sus referencias
+// débiles, sin sumar al contador: no mantiene vivo el objeto, solo su bloque.
+// Por qué sucede: Un enlace que no es dueño de su destino (como `anterior` en una lista) no forma ciclos
+// de contadores, así que el objeto se libera en cuanto muere su última referencia fuerte, sin el GC.
+// Qué deberíamos esperar: `lock()` devuelve un MPointer al objeto si sigue vivo, o uno nulo. El bloque
+// se libera cuando se sueltan la última referencia fuerte y la última débil. Con el recolector en
+// segundo plano, `lock()` va dentro de una SeccionMutador, como cualquier otro cambio de contadores;
+// un objeto que el GC libera como basura vence igual que uno liberado por su contador.
+template <typename T, typename Politica>
+class MWeakPointer {
+private:
+    friend class MPointerVista<T, Politica>;
+
+    using Enlace = EnlaceMPointer<T, false>;
+
+    Enlace enlace;  // Objeto observado y su bloque de control
+
+    // Suelta la referencia débil; la última, si el objeto ya murió, libera el bloque
+    void soltar() {
+        BloqueControl* control = enlace.bloque();
+        if (control == nullptr) {
+            return;
+        }
+        MPointer<T, Politica>::verificarMutador();  // El recolector también suelta débiles al liberar basura.
+        if (control->template soltarDebil<Politica::atomico>()) {
+            control->ops->liberarMemoria(control);
+        }
+    }
+
+    void retener() const {
+        BloqueControl* control = enlace.bloque();
+        if (control != nullptr) {
+            MPointer<T, Politica>::verificarMutador();
+            control->template retenerDebil<Politica::atomico>();
+        }
+    }
+
+public:
+    // Constructor para nullptr
+    MWeakPointer(std::nullptr_t = nullptr) {}
+
+    // Constructor a partir de un MPointer
+    // Qué sucede: Observa el objeto de `fuerte` y suma una referencia débil a su bloque.
+    // Por qué sucede: Es la única forma de obtener una referencia débil a un objeto vivo.
+    // Qué deberíamos esperar: El contador de referencias fuertes no cambia.
+    MWeakPointer(const MPointer<T, Politica>& fuerte) : enlace(fuerte.enlace) {
+        static_assert(!Politica::intrusivo, "Un objeto intrusivo no admite referencias débiles: su bloque muere con él");
+        retener();
+    }
+
+    MWeakPointer(const MWeakPointer& other) : enlace(other.enlace) {
+        retener();
+    }
+
+    MWeakPointer(MWeakPointer&& other) noexcept : enlace(other.enlace) {
+        other.enlace = Enlace();
+    }
+
+    ~MWeakPointer() {
+        soltar();
+    }
+
+    MWeakPointer& operator=(const MWeakPointer& other) {
+        Enlace nuevo = other.enlace;
+        other.retener();  // Antes de soltar, por si ambos observan el mismo bloque.
+        soltar();
+        enlace = nuevo;
+        return *this;
+    }
+
+    MWeakPointer& operator=(MWeakPointer&& other) noexcept {
+        if (this != std::addressof(other)) {
+            Enlace nuevo = other.enlace;
+            other.enlace = Enlace();
+            soltar();
+            enlace = nuevo;
+        }
+        return *this;
+    }
+
+    MWeakPointer& operator=(const MPointer<T, Politica>& fuerte) {
+        return *this = MWeakPointer(fuerte);
+    }
+
+    MWeakPointer& operator=(std::nullptr_t) {
+        soltar();
+        enlace = Enlace();
+        return *this;
+    }
+
+    // Método para obtener una referencia fuerte al objeto
+    // Qué sucede: Suma una referencia solo si el contador no llegó a 0 (con un compare-exchange si es atómico).
+    // Por qué sucede: Entre comprobar y usar el objeto, otro hilo podría soltar la última referencia.
+    // Qué deberíamos esperar: Un MPointer que mantiene vivo el objeto, o uno nulo si ya se destruyó.
+    MPointer<T, Politica> lock() const {
+        BloqueControl* control = enlace.bloque();
+        if (control == nullptr) {
+            return MPointer<T, Politica>(nullptr);
+        }
+        MPointer<T, Politica>::verificarMutador();
+        if (control->template retenerSiVive<Politica::atomico>()) {
+            return MPointer<T, Politica>(enlace.ptr, control, typename MPointer<T, Politica>::SinRegistrar{});
+        }
+        return MPointer<T, Politica>(nullptr);
+    }
+
+    // Indica si el objeto ya se destruyó (o si la referencia es nula)
+    bool expired() const {
+        BloqueControl* control = enlace.bloque();
+        return control == nullptr || control->referencias() <= 0;
+    }
+
+    // Cantidad de referencias fuertes al objeto; 0 si se destruyó
+    int useCount() const {
+        BloqueControl* control = enlace.bloque();
+        int referencias = control != nullptr ? control->referencias() : 0;
+        return referencias > 0 ? referencias : 0;
+    }
+
+    // Comparaciones con nullptr: nulo es no observar ningún objeto, no que el objeto haya vencido
+    bool operator==(std::nullptr_t) const {
+        return enlace.ptr == nullptr;
+    }
+
+    bool operator!=(std::nullptr_t) const {
+        return enlace.ptr != nullptr;
+    }
+};
+
+template <typename U, typename Politica>
+void VisitanteGC::operator()(const MPointer<U, Politica>& referencia) const {
+    visitar(referencia.enlace.bloque());
+}
+
+template <typename T, typename Politica>
+MPointer<T, Politica>::MPointer(const MPointerVista<T, Politica>& vista) : enlace(vista.enlace) {
+    retener();
+}
+
 #endif
@@ -1,35 +1,1103 @@
 #include "MPointerGC.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <typeinfo>
+#include "BloqueControl.h"
+#ifndef MPOINTERGC_SIN_PERFIL
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
 
 // Instancia única de MPointerGC
 MPointerGC MPointerGC::instance;
 
+// El hilo en segundo plano se detiene antes de destruir el registro
+MPointerGC::~MPointerGC() {
+    stopBackgroundGC();
+}
+
 // Método para obtener la instancia del singleton
 MPointerGC& MPointerGC::getInstance() {
     return instance;
 }
 
+// Método para asignar un fragmento a cada hilo, en orden rotativo
+unsigned MPointerGC::fragmentoDelHilo() {
+    static std::atomic<unsigned> siguiente{0};
+    thread_local unsigned fragmento = siguiente.fetch_add(1, std::memory_order_relaxed) % CANTIDAD_FRAGMENTOS;
+    return fragmento;
+}
+
+// Método para ubicar el fragmento de un handle
+MPointerGC::Fragmento& MPointerGC::fragmentoDe(Handle id) {
+    return fragmentos[(id >> 32) & (CANTIDAD_FRAGMENTOS - 1)];
+}
+
+// Método para ubicar la ranura de un handle
+MPointerGC::Ranura* MPointerGC::buscarRanura(Fragmento& fragmento, Handle id) {
+    std::uint32_t indice = static_cast<std::uint32_t>(id);
+    std::uint32_t generacion = static_cast<std::uint32_t>(id >> (32 + BITS_FRAGMENTO));
+    if (id == HANDLE_INVALIDO || indice >= fragmento.ranuras.size()) {
+        return nullptr;
+    }
+    Ranura& ranura = fragmento.ranuras[indice];
+    return ranura.generacion == generacion ? &ranura : nullptr;
+}
+
+// Método para agregar una entrada al registro (con el candado ya tomado)
+MPointerGC::Handle MPointerGC::agregarEntrada(Fragmento& fragmento, unsigned numero, BloqueControl* bloque, bool muestrear) {
+    std::uint32_t indice;
+    if (fragmento.primeraLibre != SIN_RANURA) {  // Reutiliza una ranura libre.
+        indice = fragmento.primeraLibre;
+        fragmento.primeraLibre = fragmento.ranuras[indice].posicion;
+    } else {  // No hay ranuras libres: la tabla crece.
+        indice = static_cast<std::uint32_t>(fragmento.ranuras.size());
+        fragmento.ranuras.push_back({1, 0});
+    }
+    fragmento.ranuras[indice].posicion = static_cast<std::uint32_t>(fragmento.vivos.size());
+    fragmento.vivos.push_back({bloque, indice});
+#ifndef MPOINTERGC_SIN_PERFIL
+    if (muestrear && --fragmento.hastaMuestra == 0) {  // Lo único que el perfil agrega a un registro.
+        muestrearSitio(fragmento, bloque->ops);
+    }
+#endif
+    Handle id = (static_cast<Handle>(fragmento.ranuras[indice].generacion) << (32 + BITS_FRAGMENTO))
+        | (static_cast<Handle>(numero) << 32) | indice;
+    if (registra(NivelRegistroGC::Detalle)) {
+        trazador.agregar(EventoGC::Registro, id, bloque->ops->bytes);
+    }
+    return id;
+}
+
 // Método para registrar un nuevo MPointer
-int MPointerGC::registerPointer(void* ptr) {
-    pointerList.push_back(ptr);
-    std::cout << "MPointer registrado. Total de punteros: " << pointerList.size() << std::endl;
-    return pointerList.size();
+MPointerGC::Handle MPointerGC::registerPointer(BloqueControl* bloque) {
+    unsigned numero = fragmentoDelHilo();
+    Fragmento& fragmento = fragmentos[numero];
+    std::lock_guard<std::mutex> candado(fragmento.mutex);
+
+    Handle id = agregarEntrada(fragmento, numero, bloque);
+    fragmento.registros.store(fragmento.registros.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    contarBytes(fragmento, static_cast<std::int64_t>(bloque->ops->bytes));
+    avisarPresion(fragmento, bloque->ops->bytes);
+    return id;
+}
+
+// Método para registrar varios bloques a la vez
+// Los contadores, los bytes y la presión se actualizan una sola vez para todo el lote.
+void MPointerGC::registerBatch(BloqueControl* const* bloques, std::size_t cantidad) {
+    if (cantidad == 0) {
+        return;
+    }
+    unsigned numero = fragmentoDelHilo();
+    Fragmento& fragmento = fragmentos[numero];
+    std::lock_guard<std::mutex> candado(fragmento.mutex);
+
+    if (fragmento.vivos.capacity() < fragmento.vivos.size() + cantidad) {  // Crece una vez, sin perder el crecimiento geométrico.
+        fragmento.vivos.reserve(std::max(fragmento.vivos.size() + cantidad, 2 * fragmento.vivos.capacity()));
+    }
+    std::size_t bytes = 0;
+    for (std::size_t i = 0; i < cantidad; i++) {
+        bloques[i]->id = agregarEntrada(fragmento, numero, bloques[i]);
+        bytes += bloques[i]->ops->bytes;
+    }
+    fragmento.registros.store(fragmento.registros.load(std::memory_order_relaxed) + cantidad, std::memory_order_relaxed);
+    contarBytes(fragmento, static_cast<std::int64_t>(bytes));
+    avisarPresion(fragmento, bytes);
+}
+
+// Método para quitar una entrada del registro (con el candado ya tomado)
+void MPointerGC::eliminarEntrada(Fragmento& fragmento, Handle id) {
+    Ranura* ranura = buscarRanura(fragmento, id);
+    if (ranura == nullptr) {
+        return;
+    }
+    std::uint32_t posicion = ranura->posicion;
+    std::size_t bytes = fragmento.vivos[posicion].bloque->ops->bytes;
+    fragmento.eliminaciones.store(fragmento.eliminaciones.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    contarBytes(fragmento, -static_cast<std::int64_t>(bytes));
+    if (registra(NivelRegistroGC::Detalle)) {
+        trazador.agregar(EventoGC::Eliminacion, id, bytes);
+    }
+
+    // Mueve la última entrada al hueco para mantener `vivos` contiguo. Si el hueco está detrás del
+    // cursor incremental, lo llena la última entrada ya recorrida y el cursor retrocede uno: así
+    // ninguna entrada sin recorrer pasa detrás de él.
+    auto mover = [&fragmento](std::uint32_t desde, std::uint32_t hacia) {
+        fragmento.vivos[hacia] = fragmento.vivos[desde];
+        fragmento.ranuras[fragmento.vivos[hacia].ranura].posicion = hacia;
+    };
+    if (&fragmento == &fragmentos[cursorFragmento] && posicion < cursorPosicion) {
+        std::uint32_t ultimaRecorrida = static_cast<std::uint32_t>(--cursorPosicion);
+        if (ultimaRecorrida != posicion) {
+            mover(ultimaRecorrida, posicion);
+        }
+        posicion = ultimaRecorrida;
+    }
+    std::uint32_t ultima = static_cast<std::uint32_t>(fragmento.vivos.size() - 1);
+    if (ultima != posicion) {
+        mover(ultima, posicion);
+    }
+    fragmento.vivos.pop_back();
+
+    // La nueva generación invalida todos los handles entregados para esta ranura.
+    ranura->generacion = (ranura->generacion + 1) & MASCARA_GENERACION;
+    if (ranura->generacion == 0) {
+        ranura->generacion = 1;
+    }
+    ranura->posicion = fragmento.primeraLibre;
+    fragmento.primeraLibre = static_cast<std::uint32_t>(id);
 }
 
 // Método para eliminar un MPointer
-void MPointerGC::deregisterPointer(void* ptr) {
-    pointerList.remove(ptr);
-    std::cout << "MPointer eliminado. Total de punteros: " << pointerList.size() << std::endl;
+void MPointerGC::deregisterPointer(Handle id) {
+    Fragmento& fragmento = fragmentoDe(id);
+    std::lock_guard<std::mutex> candado(fragmento.mutex);
+    eliminarEntrada(fragmento, id);
+}
+
+// Método para consultar si un handle sigue vigente
+bool MPointerGC::isRegistered(Handle id) {
+    Fragmento& fragmento = fragmentoDe(id);
+    std::lock_guard<std::mutex> candado(fragmento.mutex);
+    return buscarRanura(fragmento, id) != nullptr;
+}
+
+// Método para obtener el puntero asociado a un handle
+BloqueControl* MPointerGC::getPointer(Handle id) {
+    Fragmento& fragmento = fragmentoDe(id);
+    std::lock_guard<std::mutex> candado(fragmento.mutex);
+    Ranura* ranura = buscarRanura(fragmento, id);
+    return ranura != nullptr ? fragmento.vivos[ranura->posicion].bloque : nullptr;
+}
+
+// Método para contar los punteros registrados en todos los fragmentos
+std::size_t MPointerGC::size() {
+    std::size_t total = 0;
+    for (Fragmento& fragmento : fragmentos) {
+        std::lock_guard<std::mutex> candado(fragmento.mutex);
+        total += fragmento.vivos.size();
+    }
+    return total;
+}
+
+// Estados de `BloqueControl::marca` durante una recolección
+namespace {
+constexpr std::uint8_t SIN_MARCA = 0;  // Fuera de la recolección
+constexpr std::uint8_t TENTATIVO = 1;  // Aún no se encontró una referencia externa
+constexpr std::uint8_t ALCANZABLE = 2;  // Referenciado desde fuera del conjunto, directa o indirectamente
+constexpr std::uint8_t PRIMERA_VUELTA = 3;  // Desde acá, la vuelta del recolector incremental que ya lo analizó
+
+// Clausura de un tramo: agrega al conjunto lo que no está en él ni se analizó en esta vuelta
+struct Clausura {
+    std::vector<BloqueControl*>* conjunto;
+    std::uint8_t analizado;  // Marca de la vuelta actual
+};
+}
+
+// Método para llevar la cuenta de bytes vivos
+// El fragmento suma en su propio contador y publica al total global de a BYTES_POR_AVISO; el pico
+// se actualiza solo al publicar, así el camino común no toca ninguna variable compartida.
+void MPointerGC::contarBytes(Fragmento& fragmento, std::int64_t bytes) {
+    fragmento.bytesVivos.store(fragmento.bytesVivos.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+    fragmento.bytesSinPublicar += bytes;
+    if (fragmento.bytesSinPublicar < static_cast<std::int64_t>(BYTES_POR_AVISO)
+        && fragmento.bytesSinPublicar > -static_cast<std::int64_t>(BYTES_POR_AVISO)) {
+        return;
+    }
+    std::int64_t total = bytesVivosPublicados.fetch_add(fragmento.bytesSinPublicar, std::memory_order_relaxed)
+        + fragmento.bytesSinPublicar;
+    fragmento.bytesSinPublicar = 0;
+    std::int64_t pico = picoBytesVivos.load(std::memory_order_relaxed);
+    while (total > pico && !picoBytesVivos.compare_exchange_weak(pico, total, std::memory_order_relaxed)) {
+    }
+}
+
+// Método para acumular la presión de asignación
+// Cada fragmento suma localmente y solo publica cada BYTES_POR_AVISO, para no compartir un
+// contador atómico entre todos los hilos en cada registro.
+void MPointerGC::avisarPresion(Fragmento& fragmento, std::size_t bytes) {
+    fragmento.bytesSinAvisar += bytes;
+    if (fragmento.bytesSinAvisar < BYTES_POR_AVISO) {
+        return;
+    }
+    std::size_t total = bytesDesdeUltimoCiclo.fetch_add(fragmento.bytesSinAvisar, std::memory_order_relaxed)
+        + fragmento.bytesSinAvisar;
+    fragmento.bytesSinAvisar = 0;
+    despertarSiHayPresion(total);
+}
+
+// Método para avisar la presión de los objetos jóvenes, una vez por trozo lleno
+void MPointerGC::avisarPresionJoven(std::size_t bytes) {
+    despertarSiHayPresion(bytesDesdeUltimoCiclo.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+// Método para despertar al recolector en segundo plano si la presión llegó al umbral
+// El umbral se lee de su copia atómica: `configuracion` solo se lee con mutexFondo. Tomar mutexFondo
+// antes de avisar garantiza que el hilo no esté entre evaluar su predicado y dormirse, donde perdería
+// el aviso hasta el próximo `intervalo` (o para siempre, si no hay intervalo).
+void MPointerGC::despertarSiHayPresion(std::size_t total) {
+    if (!fondoActivo.load(std::memory_order_acquire) || total < umbralActivacion.load(std::memory_order_relaxed)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> candado(mutexFondo);
+    }
+    despertarFondo.notify_one();
+}
+
+// Método para juntar los objetos jóvenes vivos
+// Un espacio con contador en 0 o negativo es un objeto muerto (o en construcción, o basura de esta
+// misma recolección) cuyo espacio todavía no se reutilizó; uno con handle ya fue promovido y está en el registro.
+void MPointerGC::agregarJovenes(std::vector<BloqueControl*>& conjunto) {
+    Guarderia::recorrer([&conjunto](void* espacio) {
+        BloqueControl* bloque = static_cast<BloqueControl*>(espacio);
+        if (bloque->id == HANDLE_INVALIDO && bloque->referencias() > 0) {
+            bloque->marca = TENTATIVO;
+            conjunto.push_back(bloque);
+        }
+        return bloque->ops->bytes;
+    });
+}
+
+// Método para promover a los jóvenes que sobrevivieron
+// Saltea los bloques registrados, que el conjunto puede contener. Los promovidos no se mueven: quedan en su trozo y entran al registro como cualquier objeto. Todos
+// los de un trozo van al mismo fragmento, y los trozos se reparten entre los fragmentos por su dirección.
+void MPointerGC::promoverJovenes(const std::vector<BloqueControl*>& conjunto, std::size_t desde, ResultadoGC& resultado) {
+    std::size_t cantidad = 0;
+    for (std::size_t i = desde; i < conjunto.size(); i++) {
+        BloqueControl* bloque = conjunto[i];
+        if (bloque->id != HANDLE_INVALIDO || bloque->referencias() <= 0) {
+            continue;  // Ya registrado, o basura de esta recolección (RECOLECTADO).
+        }
+        unsigned numero = static_cast<unsigned>((reinterpret_cast<std::uintptr_t>(bloque) / Guarderia::BYTES_TROZO) % CANTIDAD_FRAGMENTOS);
+        Fragmento& fragmento = fragmentos[numero];
+        bloque->id = agregarEntrada(fragmento, numero, bloque, false);
+        fragmento.registros.store(fragmento.registros.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        contarBytes(fragmento, static_cast<std::int64_t>(bloque->ops->bytes));
+        cantidad++;
+    }
+    resultado.objetosPromovidos += cantidad;
+    promovidos.fetch_add(cantidad, std::memory_order_relaxed);
+}
+
+// Método para cerrar el intervalo de asignación
+// Las asignaciones son las registradas directamente (los registros menos las promociones) más las jóvenes.
+void MPointerGC::cerrarIntervalo(std::size_t promovidosEnCiclo) {
+    auto ahora = std::chrono::steady_clock::now();
+    std::uint64_t jovenes = Guarderia::estadisticas().asignaciones;
+    std::uint64_t registros = 0;
+    for (const Fragmento& fragmento : fragmentos) {
+        registros += fragmento.registros.load(std::memory_order_relaxed);
+    }
+    std::uint64_t asignaciones = registros - promovidos.load(std::memory_order_relaxed) + jovenes;
+    double segundos = std::chrono::duration<double>(ahora - inicioIntervalo).count();
+    if (segundos > 0.0) {
+        asignacionesPorSegundo.store((asignaciones - asignacionesAlIniciar) / segundos, std::memory_order_relaxed);
+    }
+    std::uint64_t nacidos = jovenes - jovenesAlIniciar;
+    supervivencia.store(nacidos == 0 ? 0.0 : std::min(1.0, static_cast<double>(promovidosEnCiclo) / nacidos),
+                        std::memory_order_relaxed);
+    inicioIntervalo = ahora;
+    asignacionesAlIniciar = asignaciones;
+    jovenesAlIniciar = jovenes;
+}
+
+// Método para analizar un conjunto de bloques
+// Qué sucede: Borrado de prueba. A cada contador se le restan las referencias que provienen de otros
+// bloques del conjunto; lo que sobra son referencias externas (variables locales, objetos fuera del
+// conjunto). Todo lo alcanzable desde un bloque con referencias externas sobrevive y el resto son
+// ciclos inalcanzables.
+// Por qué sucede: Los contadores por sí solos nunca liberan ciclos como siguiente/anterior en Nodo.
+// Qué deberíamos esperar: Si el conjunto está cerrado (contiene todo lo que sus bloques alcanzan), se
+// marca como basura exactamente lo inalcanzable; si no, solo la basura que no alcanza nada de afuera
+// del conjunto, porque lo de afuera cuenta como externo. Los sobrevivientes quedan con `marcaFinal`.
+// Requiere todos los candados tomados.
+void MPointerGC::analizarConjunto(std::vector<BloqueControl*>& conjunto, std::vector<BloqueControl*>& basura,
+                                  std::uint8_t marcaFinal) {
+    // 1. Cada bloque empieza con todas sus referencias.
+    for (BloqueControl* bloque : conjunto) {
+        bloque->gcRefs = bloque->referencias();
+    }
+
+    // 2. Se descuentan las referencias internas del conjunto.
+    VisitanteGC descontar([](BloqueControl* hijo, void*) {
+        if (hijo->marca == TENTATIVO) {
+            hijo->gcRefs--;
+        }
+    }, nullptr);
+    for (BloqueControl* bloque : conjunto) {
+        if (bloque->ops->trazar != nullptr) {
+            bloque->ops->trazar(bloque, descontar);
+        }
+    }
+
+    // 3. Lo alcanzable desde un bloque con referencias externas sobrevive (pila explícita, sin recursión).
+    std::vector<BloqueControl*> pendientes;
+    VisitanteGC rescatar([](BloqueControl* hijo, void* contexto) {
+        if (hijo->marca == TENTATIVO) {
+            hijo->marca = ALCANZABLE;
+            static_cast<std::vector<BloqueControl*>*>(contexto)->push_back(hijo);
+        }
+    }, &pendientes);
+    for (BloqueControl* raiz : conjunto) {
+        if (raiz->marca != TENTATIVO || raiz->gcRefs <= 0) {
+            continue;
+        }
+        raiz->marca = ALCANZABLE;
+        pendientes.push_back(raiz);
+        while (!pendientes.empty()) {
+            BloqueControl* bloque = pendientes.back();
+            pendientes.pop_back();
+            if (bloque->ops->trazar != nullptr) {
+                bloque->ops->trazar(bloque, rescatar);
+            }
+        }
+    }
+
+    // 4. Los tentativos restantes son basura: se fija su contador (RECOLECTADO) para que destruirlos no
+    // dispare liberaciones en cadena ni una referencia débil los recupere, y se quitan del registro.
+    for (BloqueControl* bloque : conjunto) {
+        if (bloque->marca == TENTATIVO) {
+            bloque->marcarRecolectado();
+            basura.push_back(bloque);
+            eliminarEntrada(fragmentoDe(bloque->id), bloque->id);
+            bloque->marca = SIN_MARCA;
+        } else {
+            bloque->marca = marcaFinal;
+        }
+    }
+}
+
+// Método para liberar la basura encontrada
+// Se llama sin los candados del registro: los destructores pueden soltar objetos vivos, que se
+// desregistran solos. Primero se destruyen todos los objetos y después se libera la memoria,
+// porque un objeto puede soltar referencias a otro bloque de la misma basura. El bloque de un objeto
+// con referencias débiles queda hasta que se suelte la última.
+void MPointerGC::liberarBasura(std::vector<BloqueControl*>& basura, ResultadoGC& resultado) {
+    // Las operaciones se guardan antes: un objeto intrusivo destruye su bloque con él.
+    std::vector<const OperacionesBloque*> operaciones;
+    operaciones.reserve(basura.size());
+    for (BloqueControl* bloque : basura) {
+        operaciones.push_back(bloque->ops);
+    }
+    for (std::size_t i = 0; i < basura.size(); i++) {
+        operaciones[i]->destruirObjeto(basura[i]);
+    }
+    for (std::size_t i = 0; i < basura.size(); i++) {
+        resultado.bytesLiberados += operaciones[i]->bytes;
+        if (operaciones[i]->bloqueEnObjeto || basura[i]->soltarDebil<true>()) {
+            operaciones[i]->liberarMemoria(basura[i]);
+        }
+    }
+    resultado.objetosLiberados += basura.size();
+}
+
+// Método para ejecutar el Garbage Collector sobre todo el registro
+ResultadoGC MPointerGC::runGC() {
+    ResultadoGC resultado;
+    {
+        MundoDetenido mundo(mutexMutadores);
+        auto inicio = std::chrono::steady_clock::now();
+        std::vector<BloqueControl*> basura;
+        {
+            // Se toman todos los candados, siempre en el mismo orden, para ver un registro consistente.
+            std::vector<std::unique_lock<std::mutex>> candados;
+            candados.reserve(CANTIDAD_FRAGMENTOS);
+            for (Fragmento& fragmento : fragmentos) {
+                candados.emplace_back(fragmento.mutex);
+            }
+            // Todo el registro, junto con los jóvenes vivos, es un conjunto cerrado.
+            std::vector<BloqueControl*> conjunto;
+            for (Fragmento& fragmento : fragmentos) {
+                for (const Entrada& entrada : fragmento.vivos) {
+                    entrada.bloque->marca = TENTATIVO;
+                    conjunto.push_back(entrada.bloque);
+                }
+            }
+            std::size_t primerJoven = conjunto.size();
+            agregarJovenes(conjunto);
+            resultado.objetosRevisados = conjunto.size();
+            analizarConjunto(conjunto, basura, SIN_MARCA);
+            promoverJovenes(conjunto, primerJoven, resultado);
+        }
+        liberarBasura(basura, resultado);
+        resultado.pausa = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - inicio);
+        cerrarIntervalo(resultado.objetosPromovidos);
+    }
+    histograma.registrar(resultado.pausa);
+    bytesDesdeUltimoCiclo.store(0, std::memory_order_relaxed);
+    informarCiclo(resultado);
+    return resultado;
+}
+
+// Método para una recolección menor
+// El conjunto de los jóvenes no es cerrado: sus referencias hacia objetos registrados no se descuentan,
+// y las de los registrados hacia ellos cuentan como externas. Por eso el análisis es conservador.
+ResultadoGC MPointerGC::runMinorGC() {
+    ResultadoGC resultado;
+    {
+        MundoDetenido mundo(mutexMutadores);
+        auto inicio = std::chrono::steady_clock::now();
+        std::vector<BloqueControl*> basura;
+        {
+            std::vector<std::unique_lock<std::mutex>> candados;
+            candados.reserve(CANTIDAD_FRAGMENTOS);
+            for (Fragmento& fragmento : fragmentos) {
+                candados.emplace_back(fragmento.mutex);
+            }
+            std::vector<BloqueControl*> conjunto;
+            agregarJovenes(conjunto);
+            resultado.objetosRevisados = conjunto.size();
+            analizarConjunto(conjunto, basura, SIN_MARCA);
+            promoverJovenes(conjunto, 0, resultado);
+        }
+        liberarBasura(basura, resultado);
+        resultado.pausa = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - inicio);
+        cerrarIntervalo(resultado.objetosPromovidos);
+    }
+    histograma.registrar(resultado.pausa);
+    informarCiclo(resultado);
+    return resultado;
 }
 
-// Método para ejecutar el Garbage Collector
-void MPointerGC::runGC() {
-    std::cout << "Ejecutando Garbage Collector..." << std::endl;
-    if (pointerList.empty()) {
+// Método para escribir el resumen de una recolección
+void MPointerGC::informarCiclo(const ResultadoGC& resultado) {
+    if (registra(NivelRegistroGC::Detalle)) {
+        trazador.agregar(EventoGC::Ciclo, resultado.objetosLiberados, resultado.bytesLiberados);
+    }
+    if (!registra(NivelRegistroGC::Ciclos)) {
+        return;
+    }
+    if (resultado.objetosLiberados == 0) {
         std::cout << "No hay punteros por liberar." << std::endl;
     } else {
-        std::cout << "Liberando los siguientes punteros: " << std::endl;
-        for (auto it = pointerList.begin(); it != pointerList.end(); ++it) {
-            std::cout << "Liberando memoria de puntero: " << *it << std::endl;
+        std::cout << "Liberados " << resultado.objetosLiberados << " objetos (" << resultado.bytesLiberados
+                  << " bytes) en " << resultado.pausa.count() / 1000 << " us." << std::endl;
+    }
+    if (resultado.objetosPromovidos > 0) {
+        std::cout << "Promovidos " << resultado.objetosPromovidos << " objetos jóvenes." << std::endl;
+    }
+}
+
+// Método para un tramo incremental
+// Qué sucede: Toma objetos desde el cursor y agrega lo que alcanzan hasta cubrir el presupuesto,
+// estimado con el costo por objeto de los tramos anteriores, y analiza ese conjunto. La clausura de
+// cada semilla se corta en el objetivo del tramo y saltea lo ya analizado en esta vuelta, que los
+// sobrevivientes llevan en su marca.
+// Por qué sucede: Un conjunto no cerrado también se puede analizar: lo que alcanza afuera cuenta como
+// referencia externa, así que nunca se libera algo vivo. Cortar la clausura acota el trabajo del tramo
+// aunque la estructura sea enorme, y la marca de la vuelta hace que cada objeto se analice una vez por
+// vuelta en lugar de una vez por semilla.
+// Qué deberíamos esperar: Un tramo analiza a lo sumo unas dos veces su objetivo. eliminarEntrada nunca
+// deja una entrada sin recorrer detrás del cursor, así que en una vuelta completa se analiza todo lo
+// que estaba registrado al empezarla. Un ciclo que entra en el objetivo se libera completo en el tramo
+// que lo encuentra; la basura más grande que un tramo sobrevive a los tramos, que marcan
+// `estructuraCortada`, y la libera runGC. El primer tramo de cada vuelta analiza además los jóvenes
+// vivos y los promueve, así que puede exceder el presupuesto.
+bool MPointerGC::tramo(std::chrono::nanoseconds presupuesto, ResultadoGC& resultado) {
+    std::size_t objetivo = static_cast<std::size_t>(presupuesto.count() / nanosegundosPorObjeto);
+    if (objetivo < 64) {
+        objetivo = 64;
+    }
+    bool vueltaCompleta = false;
+    const bool inicioVuelta = cursorFragmento == 0 && cursorPosicion == 0;
+    if (inicioVuelta) {  // Una marca nueva: lo analizado en vueltas anteriores se vuelve a analizar.
+        marcaVuelta = marcaVuelta < PRIMERA_VUELTA || marcaVuelta == UINT8_MAX ? PRIMERA_VUELTA : marcaVuelta + 1;
+    }
+    std::vector<BloqueControl*> basura;
+    {
+        std::vector<std::unique_lock<std::mutex>> candados;
+        candados.reserve(CANTIDAD_FRAGMENTOS);
+        for (Fragmento& fragmento : fragmentos) {
+            candados.emplace_back(fragmento.mutex);
+        }
+
+        std::vector<BloqueControl*> conjunto;
+        Clausura clausura{&conjunto, marcaVuelta};
+        VisitanteGC agregar([](BloqueControl* hijo, void* contexto) {
+            Clausura* clausura = static_cast<Clausura*>(contexto);
+            if (hijo->marca != TENTATIVO && hijo->marca != clausura->analizado && hijo->id != HANDLE_INVALIDO) {
+                hijo->marca = TENTATIVO;
+                clausura->conjunto->push_back(hijo);
+            }
+        }, &clausura);
+        // Recorre lo agregado desde `desde` hasta que el conjunto llega a `hasta`; lo último agregado
+        // queda sin recorrer y sus hijos, fuera del conjunto. Anota en el resultado si cortó.
+        auto clausurar = [&conjunto, &agregar, &resultado](std::size_t desde, std::size_t hasta) {
+            std::size_t i = desde;
+            for (; i < conjunto.size() && conjunto.size() < hasta; i++) {
+                if (conjunto[i]->ops->trazar != nullptr) {
+                    conjunto[i]->ops->trazar(conjunto[i], agregar);
+                }
+            }
+            if (i < conjunto.size()) {
+                resultado.estructuraCortada = true;
+            }
+        };
+        if (inicioVuelta) {
+            agregarJovenes(conjunto);
+            clausurar(0, conjunto.size() + objetivo);  // Lo que los jóvenes alcanzan en el registro.
+        }
+        std::size_t salteadas = 0;  // Semillas ya analizadas: baratas, pero también cuentan
+        while (conjunto.size() + salteadas < objetivo) {
+            Fragmento& fragmento = fragmentos[cursorFragmento];
+            if (cursorPosicion >= fragmento.vivos.size()) {  // Pasa al siguiente fragmento.
+                cursorPosicion = 0;
+                cursorFragmento = (cursorFragmento + 1) % CANTIDAD_FRAGMENTOS;
+                if (cursorFragmento == 0) {
+                    vueltaCompleta = true;
+                    break;
+                }
+                continue;
+            }
+            BloqueControl* semilla = fragmento.vivos[cursorPosicion++].bloque;
+            if (semilla->marca == TENTATIVO || semilla->marca == marcaVuelta) {
+                salteadas++;  // Ya entró al conjunto por otro camino, o a uno de esta vuelta.
+                continue;
+            }
+            // Clausura de la semilla: el conjunto crece mientras se recorre, hasta un objetivo por semilla.
+            std::size_t desde = conjunto.size();
+            semilla->marca = TENTATIVO;
+            conjunto.push_back(semilla);
+            clausurar(desde, desde + objetivo);
         }
+        resultado.objetosRevisados += conjunto.size();
+        analizarConjunto(conjunto, basura, marcaVuelta);
+        if (inicioVuelta) {
+            promoverJovenes(conjunto, 0, resultado);
+        }
+    }
+    liberarBasura(basura, resultado);
+    if (inicioVuelta) {
+        cerrarIntervalo(resultado.objetosPromovidos);
+    }
+    return vueltaCompleta;
+}
+
+// Método para ejecutar un tramo con los mutadores detenidos, midiendo su pausa
+bool MPointerGC::tramoMedido(std::chrono::nanoseconds presupuesto, ResultadoGC& resultado) {
+    bool vueltaCompleta;
+    {
+        MundoDetenido mundo(mutexMutadores);
+        auto inicio = std::chrono::steady_clock::now();
+        vueltaCompleta = tramo(presupuesto, resultado);
+        resultado.pausa = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - inicio);
+        if (resultado.objetosRevisados > 0) {
+            // Promedio móvil del costo por objeto, para dimensionar el próximo tramo.
+            double medido = static_cast<double>(resultado.pausa.count()) / resultado.objetosRevisados;
+            nanosegundosPorObjeto = 0.75 * nanosegundosPorObjeto + 0.25 * medido;
+        }
+    }
+    histograma.registrar(resultado.pausa);
+    return vueltaCompleta;
+}
+
+// Método para ejecutar un tramo incremental
+ResultadoGC MPointerGC::runGCSlice(std::chrono::nanoseconds presupuesto) {
+    ResultadoGC resultado;
+    tramoMedido(presupuesto, resultado);
+    return resultado;
+}
+
+// Método para iniciar el recolector en segundo plano
+void MPointerGC::startBackgroundGC(const ConfiguracionGC& config) {
+    stopBackgroundGC();
+    {
+        std::lock_guard<std::mutex> candado(mutexFondo);
+        configuracion = config;
+        detenerFondo = false;
+    }
+    umbralActivacion.store(config.bytesParaActivar, std::memory_order_relaxed);
+    fondoActivo.store(true, std::memory_order_release);
+    hiloFondo = std::thread(&MPointerGC::bucleFondo, this);
+}
+
+// Método para detener el recolector en segundo plano
+void MPointerGC::stopBackgroundGC() {
+    if (!hiloFondo.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> candado(mutexFondo);
+        detenerFondo = true;
+    }
+    despertarFondo.notify_one();
+    hiloFondo.join();
+    fondoActivo.store(false, std::memory_order_relaxed);
+}
+
+// Bucle del recolector en segundo plano
+// Espera presión de asignación (o el intervalo, si está configurado) y entonces da una vuelta completa
+// al registro en tramos de `pausaMaxima`, cediendo `espacioEntreTramos` entre uno y otro. Cada vuelta
+// libera los ciclos que entran en un tramo. Si la despertó la presión y algún tramo cortó una
+// estructura, puede haber basura que ningún tramo libera: la vuelta termina con un runGC. Si ese runGC
+// no libera nada, lo cortado estaba vivo, y no se vuelve a escalar hasta que los bytes vivos crezcan
+// `bytesParaActivar`; así una estructura grande y viva no cuesta una pausa completa por vuelta, y una
+// basura grande que se repite sí se libera. Sin presión (solo `intervalo`) nunca se escala.
+// runGC y stats() se llaman sin mutexFondo, como los tramos.
+void MPointerGC::bucleFondo() {
+    bool cortadasVivas = false;  // El último runGC escalado no liberó nada
+    std::uint64_t bytesTrasEscalar = 0;  // Bytes vivos después de ese runGC
+    std::unique_lock<std::mutex> candado(mutexFondo);
+    while (!detenerFondo) {
+        auto hayPresion = [this] {
+            return detenerFondo
+                || bytesDesdeUltimoCiclo.load(std::memory_order_relaxed) >= umbralActivacion.load(std::memory_order_relaxed);
+        };
+        if (configuracion.intervalo.count() > 0) {
+            despertarFondo.wait_for(candado, configuracion.intervalo, hayPresion);
+        } else {
+            despertarFondo.wait(candado, hayPresion);
+        }
+        if (detenerFondo) {
+            break;
+        }
+        const bool porPresion = bytesDesdeUltimoCiclo.load(std::memory_order_relaxed) >= umbralActivacion.load(std::memory_order_relaxed);
+        bytesDesdeUltimoCiclo.store(0, std::memory_order_relaxed);
+
+        // Un ciclo: una vuelta completa del cursor, en tramos.
+        bool vueltaCompleta = false;
+        bool cortada = false;
+        while (!vueltaCompleta && !detenerFondo) {
+            std::chrono::nanoseconds pausaMaxima = configuracion.pausaMaxima;
+            candado.unlock();
+            ResultadoGC resultado;
+            vueltaCompleta = tramoMedido(pausaMaxima, resultado);
+            cortada = cortada || resultado.estructuraCortada;
+            candado.lock();
+            despertarFondo.wait_for(candado, configuracion.espacioEntreTramos, [this] { return detenerFondo; });
+        }
+        if (vueltaCompleta && cortada && porPresion && !detenerFondo) {
+            std::uint64_t crecimiento = configuracion.bytesParaActivar;
+            candado.unlock();
+            if (!cortadasVivas || stats().bytesVivos >= bytesTrasEscalar + crecimiento) {
+                cortadasVivas = runGC().objetosLiberados == 0;
+                bytesTrasEscalar = stats().bytesVivos;
+            }
+            candado.lock();
+        }
+    }
+}
+
+// Métodos para consultar y reiniciar las pausas
+EstadisticasPausas MPointerGC::pauseStats() const {
+    return histograma.resumen();
+}
+
+void MPointerGC::resetPauseStats() {
+    histograma.reiniciar();
+}
+
+// Método para sumar los contadores de todos los fragmentos
+EstadisticasGC MPointerGC::stats() const {
+    EstadisticasGC estadisticas;
+    for (const Fragmento& fragmento : fragmentos) {
+        estadisticas.asignacionesTotales += fragmento.registros.load(std::memory_order_relaxed);
+        estadisticas.liberacionesTotales += fragmento.eliminaciones.load(std::memory_order_relaxed);
+        estadisticas.bytesVivos += fragmento.bytesVivos.load(std::memory_order_relaxed);
+    }
+    // Leídos por separado, los contadores pueden cruzarse con un registro en curso.
+    if (estadisticas.asignacionesTotales > estadisticas.liberacionesTotales) {
+        estadisticas.objetosVivos = estadisticas.asignacionesTotales - estadisticas.liberacionesTotales;
+    }
+    std::int64_t pico = picoBytesVivos.load(std::memory_order_relaxed);
+    estadisticas.picoBytesVivos = static_cast<std::uint64_t>(pico) > estadisticas.bytesVivos
+        ? static_cast<std::uint64_t>(pico) : estadisticas.bytesVivos;
+
+    Guarderia::Estadisticas guarderia = Guarderia::estadisticas();
+    estadisticas.asignacionesJovenes = guarderia.asignaciones;
+    estadisticas.bytesAsignadosJovenes = guarderia.bytesAsignados;
+    estadisticas.bytesGuarderia = guarderia.trozos * Guarderia::BYTES_TROZO;
+    estadisticas.promovidos = promovidos.load(std::memory_order_relaxed);
+    estadisticas.asignacionesPorSegundo = asignacionesPorSegundo.load(std::memory_order_relaxed);
+    estadisticas.supervivencia = supervivencia.load(std::memory_order_relaxed);
+    return estadisticas;
+}
+
+// Método para activar el modo generacional
+void MPointerGC::setGenerationalMode(bool activo) {
+    Guarderia::activar(activo);
+}
+
+// Métodos para el nivel de registro y el trazador
+void MPointerGC::setLogLevel(NivelRegistroGC nivel) {
+    nivelRegistro.store(nivel, std::memory_order_relaxed);
+}
+
+bool MPointerGC::registra(NivelRegistroGC nivel) const {
+#ifdef MPOINTERGC_SIN_TRAZA
+    if (nivel == NivelRegistroGC::Detalle) {
+        return false;  // El trazado se quita al compilar.
+    }
+#endif
+    return nivelRegistro.load(std::memory_order_relaxed) >= nivel;
+}
+
+std::size_t MPointerGC::dumpTrace(std::ostream& salida) {
+    return trazador.volcar(salida);
+}
+
+// Métodos del perfil del heap
+// La pila se guarda sin traducir: los nombres se buscan solo al consultar el perfil.
+// Se descarta el marco de este método; los del registro quedan, para ver por qué camino se llegó.
+void MPointerGC::muestrearSitio(Fragmento& fragmento, const OperacionesBloque* ops) {
+#ifndef MPOINTERGC_SIN_PERFIL
+    std::lock_guard<std::mutex> candado(mutexPerfil);
+    if (intervaloMuestreo == 0) {  // La cuenta sin muestreo llegó a cero: vuelve a empezar.
+        fragmento.hastaMuestra = SIN_MUESTREO;
+        return;
+    }
+    fragmento.hastaMuestra = intervaloMuestreo;
+
+    void* pila[MARCOS_POR_MUESTRA + 1];
+    int profundidad = ::backtrace(pila, MARCOS_POR_MUESTRA + 1) - 1;
+    if (profundidad <= 0) {
+        return;
+    }
+    std::uint64_t hash = 14695981039346656037ull;  // FNV-1a sobre las direcciones
+    hash = (hash ^ reinterpret_cast<std::uintptr_t>(ops)) * 1099511628211ull;
+    for (int i = 0; i < profundidad; i++) {
+        hash = (hash ^ reinterpret_cast<std::uintptr_t>(pila[i + 1])) * 1099511628211ull;
+    }
+
+    auto [posicion, nueva] = muestras.try_emplace(hash);
+    MuestraSitio& muestra = posicion->second;
+    if (nueva) {
+        muestra.ops = ops;
+        muestra.profundidad = profundidad;
+        std::copy(pila + 1, pila + 1 + profundidad, muestra.marcos);
+        muestra.muestras = 0;
+    }
+    muestra.muestras++;
+#else
+    (void)fragmento;
+    (void)ops;
+#endif
+}
+
+void MPointerGC::setAllocationSampling(std::uint32_t cadaN) {
+    {
+        std::lock_guard<std::mutex> candado(mutexPerfil);
+        intervaloMuestreo = cadaN;
+    }
+    for (Fragmento& fragmento : fragmentos) {
+        std::lock_guard<std::mutex> candado(fragmento.mutex);
+        fragmento.hastaMuestra = cadaN == 0 ? SIN_MUESTREO : cadaN;
+    }
+}
+
+#ifndef MPOINTERGC_SIN_PERFIL
+// Nombre legible de un tipo o de una función
+static std::string desenredar(const char* nombre) {
+#if defined(__GNUG__)
+    int estado = 0;
+    char* legible = abi::__cxa_demangle(nombre, nullptr, nullptr, &estado);
+    if (estado == 0 && legible != nullptr) {
+        std::string resultado(legible);
+        std::free(legible);
+        return resultado;
+    }
+#endif
+    return nombre;
+}
+
+// Nombre de un marco: la función y el desplazamiento si el símbolo es visible, si no el módulo
+static std::string nombreDeMarco(void* direccion) {
+    char desplazamiento[32];
+    Dl_info informacion;
+    if (::dladdr(direccion, &informacion) == 0) {
+        std::snprintf(desplazamiento, sizeof(desplazamiento), "%p", direccion);
+        return desplazamiento;
+    }
+    if (informacion.dli_sname != nullptr) {
+        std::snprintf(desplazamiento, sizeof(desplazamiento), "+0x%zx", static_cast<std::size_t>(
+            static_cast<char*>(direccion) - static_cast<char*>(informacion.dli_saddr)));
+        return desenredar(informacion.dli_sname) + desplazamiento;
+    }
+    std::string modulo = informacion.dli_fname != nullptr ? informacion.dli_fname : "?";
+    std::size_t barra = modulo.rfind('/');
+    std::snprintf(desplazamiento, sizeof(desplazamiento), "+0x%zx", static_cast<std::size_t>(
+        static_cast<char*>(direccion) - static_cast<char*>(informacion.dli_fbase)));
+    return (barra == std::string::npos ? modulo : modulo.substr(barra + 1)) + desplazamiento;
+}
+#endif
+
+PerfilHeap MPointerGC::heapProfile() {
+    PerfilHeap perfil;
+#ifndef MPOINTERGC_SIN_PERFIL
+    perfil.habilitado = true;
+
+    // Cada fragmento se agrupa por operaciones con su candado tomado; los nombres se buscan al final.
+    std::unordered_map<const OperacionesBloque*, std::uint64_t> porOperaciones;
+    std::uint64_t asignaciones = 0;
+    for (Fragmento& fragmento : fragmentos) {
+        std::lock_guard<std::mutex> candado(fragmento.mutex);
+        const OperacionesBloque* anterior = nullptr;  // Los bloques de un mismo tipo suelen venir seguidos.
+        std::uint64_t* cantidad = nullptr;
+        for (const Entrada& entrada : fragmento.vivos) {
+            if (entrada.bloque->ops != anterior) {
+                anterior = entrada.bloque->ops;
+                cantidad = &porOperaciones[anterior];
+            }
+            (*cantidad)++;
+        }
+        asignaciones += fragmento.registros.load(std::memory_order_relaxed);
+    }
+
+    std::map<std::string, PerfilTipo> porNombre;  // Une las operaciones distintas de un mismo tipo
+    for (const auto& [ops, cantidad] : porOperaciones) {
+        std::string nombre = desenredar(ops->tipo->name());
+        PerfilTipo& tipo = porNombre[nombre];
+        tipo.tipo = nombre;
+        tipo.objetosVivos += cantidad;
+        tipo.bytesVivos += cantidad * ops->bytes;
+    }
+    for (auto& [nombre, tipo] : porNombre) {
+        perfil.tipos.push_back(std::move(tipo));
+    }
+    std::sort(perfil.tipos.begin(), perfil.tipos.end(), [](const PerfilTipo& a, const PerfilTipo& b) {
+        return a.bytesVivos != b.bytesVivos ? a.bytesVivos > b.bytesVivos : a.tipo < b.tipo;
+    });
+
+    std::lock_guard<std::mutex> candado(mutexPerfil);
+    perfil.intervaloMuestreo = intervaloMuestreo;
+    for (const auto& [hash, muestra] : muestras) {
+        SitioAsignacion sitio;
+        sitio.tipo = desenredar(muestra.ops->tipo->name());
+        for (int i = 0; i < muestra.profundidad; i++) {
+            sitio.marcos.push_back(nombreDeMarco(muestra.marcos[i]));
+        }
+        sitio.muestras = muestra.muestras;
+        sitio.bytes = muestra.muestras * muestra.ops->bytes;
+        perfil.sitios.push_back(std::move(sitio));
+    }
+    std::sort(perfil.sitios.begin(), perfil.sitios.end(), [](const SitioAsignacion& a, const SitioAsignacion& b) {
+        return a.muestras > b.muestras;
+    });
+
+    auto ahora = std::chrono::steady_clock::now();
+    perfil.segundos = std::chrono::duration<double>(ahora - consultaPerfil).count();
+    perfil.asignaciones = asignaciones - asignacionesConsultadas;
+    perfil.asignacionesPorSegundo = perfil.segundos > 0.0 ? perfil.asignaciones / perfil.segundos : 0.0;
+    consultaPerfil = ahora;
+    asignacionesConsultadas = asignaciones;
+#endif
+    return perfil;
+}
+
+// Escribe una cadena con las secuencias de escape de JSON (sirven también para las etiquetas de Prometheus)
+static void escribirEscapada(std::ostream& salida, const std::string& texto) {
+    salida << '"';
+    for (char caracter : texto) {
+        switch (caracter) {
+        case '"': salida << "\\\""; break;
+        case '\\': salida << "\\\\"; break;
+        case '\n': salida << "\\n"; break;
+        default:
+            if (static_cast<unsigned char>(caracter) < 0x20) {
+                char codigo[8];
+                std::snprintf(codigo, sizeof(codigo), "\\u%04x", caracter);
+                salida << codigo;
+            } else {
+                salida << caracter;
+            }
+        }
+    }
+    salida << '"';
+}
+
+static void escribirJson(std::ostream& salida, const PerfilHeap& perfil) {
+    salida << "{\"habilitado\":" << (perfil.habilitado ? "true" : "false")
+           << ",\"segundos\":" << perfil.segundos
+           << ",\"asignaciones\":" << perfil.asignaciones
+           << ",\"asignacionesPorSegundo\":" << perfil.asignacionesPorSegundo
+           << ",\"intervaloMuestreo\":" << perfil.intervaloMuestreo
+           << ",\"tipos\":[";
+    for (std::size_t i = 0; i < perfil.tipos.size(); i++) {
+        const PerfilTipo& tipo = perfil.tipos[i];
+        salida << (i == 0 ? "" : ",") << "{\"tipo\":";
+        escribirEscapada(salida, tipo.tipo);
+        salida << ",\"objetosVivos\":" << tipo.objetosVivos << ",\"bytesVivos\":" << tipo.bytesVivos << '}';
+    }
+    salida << "],\"sitios\":[";
+    for (std::size_t i = 0; i < perfil.sitios.size(); i++) {
+        const SitioAsignacion& sitio = perfil.sitios[i];
+        salida << (i == 0 ? "" : ",") << "{\"tipo\":";
+        escribirEscapada(salida, sitio.tipo);
+        salida << ",\"muestras\":" << sitio.muestras << ",\"bytes\":" << sitio.bytes << ",\"marcos\":[";
+        for (std::size_t j = 0; j < sitio.marcos.size(); j++) {
+            salida << (j == 0 ? "" : ",");
+            escribirEscapada(salida, sitio.marcos[j]);
+        }
+        salida << "]}";
+    }
+    salida << "]}\n";
+}
+
+// Una métrica por tipo, con su ayuda y su clase (gauge o counter)
+template <typename Valor>
+static void escribirMetrica(std::ostream& salida, const PerfilHeap& perfil, const char* nombre, const char* clase,
+                            const char* ayuda, Valor valor) {
+    salida << "# HELP " << nombre << ' ' << ayuda << "\n# TYPE " << nombre << ' ' << clase << '\n';
+    for (const PerfilTipo& tipo : perfil.tipos) {
+        salida << nombre << "{tipo=";
+        escribirEscapada(salida, tipo.tipo);
+        salida << "} " << valor(tipo) << '\n';
+    }
+}
+
+static void escribirPrometheus(std::ostream& salida, const PerfilHeap& perfil) {
+    escribirMetrica(salida, perfil, "mpointer_objetos_vivos", "gauge", "Objetos registrados actualmente",
+                    [](const PerfilTipo& tipo) { return tipo.objetosVivos; });
+    escribirMetrica(salida, perfil, "mpointer_bytes_vivos", "gauge", "Memoria de los objetos registrados, con sus bloques",
+                    [](const PerfilTipo& tipo) { return tipo.bytesVivos; });
+    salida << "# HELP mpointer_asignaciones_por_segundo Registros por segundo desde la consulta anterior\n"
+           << "# TYPE mpointer_asignaciones_por_segundo gauge\n"
+           << "mpointer_asignaciones_por_segundo " << perfil.asignacionesPorSegundo << '\n';
+    if (!perfil.sitios.empty()) {
+        // La pila va en una sola etiqueta, con los marcos separados por ';' de la más externa a la más interna.
+        salida << "# HELP mpointer_muestras_asignacion_total Registros muestreados por pila de llamadas\n"
+               << "# TYPE mpointer_muestras_asignacion_total counter\n";
+        for (const SitioAsignacion& sitio : perfil.sitios) {
+            std::string pila;
+            for (auto marco = sitio.marcos.rbegin(); marco != sitio.marcos.rend(); ++marco) {
+                pila += (pila.empty() ? "" : ";") + *marco;
+            }
+            salida << "mpointer_muestras_asignacion_total{tipo=";
+            escribirEscapada(salida, sitio.tipo);
+            salida << ",pila=";
+            escribirEscapada(salida, pila);
+            salida << "} " << sitio.muestras << '\n';
+        }
+    }
+}
+
+void MPointerGC::dumpHeapProfile(std::ostream& salida, FormatoPerfil formato) {
+    PerfilHeap perfil = heapProfile();
+    if (formato == FormatoPerfil::Json) {
+        escribirJson(salida, perfil);
+    } else {
+        escribirPrometheus(salida, perfil);
+    }
+}
+
+// Método para agregar un evento al trazador
+void TrazadorGC::agregar(EventoGC::Tipo tipo, std::uint64_t handle, std::uint64_t bytes) {
+    std::uint64_t posicion = escritura.fetch_add(1, std::memory_order_relaxed);
+    Casilla& casilla = casillas[posicion & (CAPACIDAD - 1)];
+    casilla.secuencia.store(0, std::memory_order_relaxed);  // Marca la casilla como en escritura.
+    std::atomic_thread_fence(std::memory_order_release);
+    casilla.tipo.store(tipo, std::memory_order_relaxed);
+    casilla.handle.store(handle, std::memory_order_relaxed);
+    casilla.bytes.store(bytes, std::memory_order_relaxed);
+    casilla.nanosegundos.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+    casilla.secuencia.store(posicion + 1, std::memory_order_release);
+}
+
+// Método para volcar los eventos pendientes
+// Un evento se escribe solo si su secuencia coincide antes y después de leerlo; los que se pisaron
+// o todavía se están escribiendo se descartan.
+std::size_t TrazadorGC::volcar(std::ostream& salida) {
+    static const char* const nombres[] = {"registro", "eliminacion", "ciclo"};
+    std::lock_guard<std::mutex> candado(mutexLectura);
+    std::uint64_t hasta = escritura.load(std::memory_order_acquire);
+    if (hasta - lectura > CAPACIDAD) {
+        lectura = hasta - CAPACIDAD;  // Los más viejos ya se pisaron.
+    }
+    std::size_t escritos = 0;
+    for (; lectura < hasta; lectura++) {
+        Casilla& casilla = casillas[lectura & (CAPACIDAD - 1)];
+        if (casilla.secuencia.load(std::memory_order_acquire) != lectura + 1) {
+            continue;
+        }
+        std::uint8_t tipo = casilla.tipo.load(std::memory_order_relaxed);
+        std::uint64_t handle = casilla.handle.load(std::memory_order_relaxed);
+        std::uint64_t bytes = casilla.bytes.load(std::memory_order_relaxed);
+        std::int64_t nanosegundos = casilla.nanosegundos.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (casilla.secuencia.load(std::memory_order_relaxed) != lectura + 1 || tipo > EventoGC::Ciclo) {
+            continue;
+        }
+        salida << nanosegundos << ' ' << nombres[tipo] << ' ' << handle << ' ' << bytes << '\n';
+        escritos++;
+    }
+    return escritos;
+}
+
+// Método para ubicar la cubeta de una pausa
+unsigned HistogramaPausas::cubetaDe(std::uint64_t microsegundos) {
+    if (microsegundos < 4) {
+        return static_cast<unsigned>(microsegundos);
+    }
+    unsigned exponente = 63 - static_cast<unsigned>(__builtin_clzll(microsegundos));
+    unsigned sub = static_cast<unsigned>((microsegundos >> (exponente - 2)) & 3);
+    unsigned cubeta = 4 * (exponente - 1) + sub;
+    return cubeta < CUBETAS ? cubeta : CUBETAS - 1;
+}
+
+// Método para obtener el mayor valor (en microsegundos) que cae en una cubeta
+std::uint64_t HistogramaPausas::limiteSuperior(unsigned cubeta) {
+    if (cubeta < 4) {
+        return cubeta;
+    }
+    unsigned exponente = cubeta / 4 + 1;
+    std::uint64_t sub = cubeta % 4;
+    return ((4 + sub + 1) << (exponente - 2)) - 1;
+}
+
+// Método para registrar una pausa
+void HistogramaPausas::registrar(std::chrono::nanoseconds pausa) {
+    std::uint64_t microsegundos = static_cast<std::uint64_t>(pausa.count()) / 1000;
+    cubetas[cubetaDe(microsegundos)].fetch_add(1, std::memory_order_relaxed);
+    std::int64_t anterior = maxima.load(std::memory_order_relaxed);
+    while (pausa.count() > anterior && !maxima.compare_exchange_weak(anterior, pausa.count(), std::memory_order_relaxed)) {
+    }
+}
+
+// Método para calcular los percentiles
+EstadisticasPausas HistogramaPausas::resumen() const {
+    EstadisticasPausas estadisticas;
+    std::uint64_t conteos[CUBETAS];
+    for (unsigned i = 0; i < CUBETAS; i++) {
+        conteos[i] = cubetas[i].load(std::memory_order_relaxed);
+        estadisticas.cantidad += conteos[i];
+    }
+    estadisticas.maxima = std::chrono::nanoseconds(maxima.load(std::memory_order_relaxed));
+    if (estadisticas.cantidad == 0) {
+        return estadisticas;
+    }
+    auto percentil = [&](double fraccion) {
+        std::uint64_t objetivo = static_cast<std::uint64_t>(fraccion * estadisticas.cantidad);
+        if (objetivo == 0) {
+            objetivo = 1;
+        }
+        std::uint64_t acumulado = 0;
+        for (unsigned i = 0; i < CUBETAS; i++) {
+            acumulado += conteos[i];
+            if (acumulado >= objetivo) {
+                std::chrono::nanoseconds limite = std::chrono::microseconds(limiteSuperior(i) + 1);
+                return limite < estadisticas.maxima ? limite : estadisticas.maxima;
+            }
+        }
+        return estadisticas.maxima;
+    };
+    estadisticas.p50 = percentil(0.50);
+    estadisticas.p99 = percentil(0.99);
+    return estadisticas;
+}
+
+// Método para vaciar el histograma
+void HistogramaPausas::reiniciar() {
+    for (std::atomic<std::uint64_t>& cubeta : cubetas) {
+        cubeta.store(0, std::memory_order_relaxed);
     }
+    maxima.store(0, std::memory_order_relaxed);
 }
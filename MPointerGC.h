@@ -1,29 +1,507 @@
 #ifndef MPOINTERGC_H
 #define MPOINTERGC_H
 
-#include <list>
-#include <iostream>  // Asegura que se incluye para usar std::cout y std::endl
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+struct BloqueControl;
+struct OperacionesBloque;
+class Guarderia;
+
+// Resultado de una ejecución del Garbage Collector
+struct ResultadoGC {
+    std::size_t objetosRevisados = 0;  // Objetos analizados en la recolección (o en el tramo)
+    std::size_t objetosLiberados = 0;  // Objetos inalcanzables que se liberaron
+    std::size_t bytesLiberados = 0;  // Memoria devuelta, contando objeto y bloque de control
+    std::size_t objetosPromovidos = 0;  // Objetos jóvenes que sobrevivieron y pasaron al registro
+    std::chrono::nanoseconds pausa{0};  // Tiempo con los mutadores detenidos
+    bool estructuraCortada = false;  // El tramo no alcanzó a cerrar alguna estructura más grande que su objetivo
+};
+
+// Configuración del recolector en segundo plano
+struct ConfiguracionGC {
+    std::chrono::microseconds pausaMaxima{200};  // Presupuesto de cada tramo incremental
+    std::chrono::microseconds espacioEntreTramos{200};  // Tiempo que se devuelve a los mutadores entre tramos
+    std::size_t bytesParaActivar = 8u << 20;  // Bytes registrados desde el último ciclo que disparan uno nuevo
+    std::chrono::milliseconds intervalo{0};  // Ciclo periódico aunque no haya presión (0 lo desactiva)
+};
+
+// Percentiles de las pausas registradas
+struct EstadisticasPausas {
+    std::uint64_t cantidad = 0;
+    std::chrono::nanoseconds p50{0};
+    std::chrono::nanoseconds p99{0};
+    std::chrono::nanoseconds maxima{0};
+};
+
+// Histograma log-lineal de pausas: cuatro cubetas por cada potencia de dos de microsegundos,
+// así que un percentil se reporta con un error menor al 25 %. Se actualiza sin candados.
+class HistogramaPausas {
+public:
+    static constexpr unsigned CUBETAS = 4 * 32;
+
+    void registrar(std::chrono::nanoseconds pausa);
+    EstadisticasPausas resumen() const;
+    void reiniciar();
+
+private:
+    std::atomic<std::uint64_t> cubetas[CUBETAS] = {};
+    std::atomic<std::int64_t> maxima{0};
+
+    static unsigned cubetaDe(std::uint64_t microsegundos);
+    static std::uint64_t limiteSuperior(unsigned cubeta);
+};
+
+// Contadores del registro, para consultar desde fuera sin detener a nadie
+struct EstadisticasGC {
+    std::uint64_t objetosVivos = 0;  // Objetos registrados actualmente
+    std::uint64_t asignacionesTotales = 0;  // Registros desde que empezó el programa, incluidas las promociones
+    std::uint64_t liberacionesTotales = 0;  // Eliminaciones del registro desde que empezó el programa
+    std::uint64_t bytesVivos = 0;  // Memoria de los objetos registrados, con sus bloques
+    std::uint64_t picoBytesVivos = 0;  // Máximo de bytesVivos observado
+
+    // Modo generacional: los objetos jóvenes no cuentan en los campos anteriores hasta que se promueven
+    std::uint64_t asignacionesJovenes = 0;  // Objetos que nacieron en la guardería
+    std::uint64_t bytesAsignadosJovenes = 0;
+    std::uint64_t promovidos = 0;  // Jóvenes que sobrevivieron a una recolección y pasaron al registro
+    std::uint64_t bytesGuarderia = 0;  // Memoria de los trozos de la guardería, en uso o en reserva
+    // Del intervalo que terminó con la última recolección (runGC, runMinorGC o una vuelta en segundo plano):
+    double asignacionesPorSegundo = 0.0;  // Objetos creados por segundo, jóvenes o registrados directamente
+    double supervivencia = 0.0;  // Fracción de los jóvenes nacidos en el intervalo que se promovió
+};
+
+// Objetos de un tipo en el perfil del heap
+struct PerfilTipo {
+    std::string tipo;  // Nombre del tipo, legible si el compilador permite desenredarlo
+    std::uint64_t objetosVivos = 0;
+    std::uint64_t bytesVivos = 0;  // Con sus bloques de control, como en EstadisticasGC
+};
+
+// Lugar del programa desde el que se registraron las asignaciones muestreadas
+struct SitioAsignacion {
+    std::string tipo;
+    std::vector<std::string> marcos;  // Pila de llamadas, de la más interna a la más externa
+    std::uint64_t muestras = 0;
+    std::uint64_t bytes = 0;  // Bytes de las asignaciones muestreadas (no de todas)
+};
+
+// Foto del heap por tipo, ordenada de mayor a menor por bytes vivos
+struct PerfilHeap {
+    bool habilitado = false;  // false si se compiló con MPOINTERGC_SIN_PERFIL
+    double segundos = 0.0;  // Tiempo desde la consulta anterior (o desde el inicio)
+    std::uint64_t asignaciones = 0;  // Registros en ese tiempo
+    double asignacionesPorSegundo = 0.0;
+    std::uint32_t intervaloMuestreo = 0;  // Una muestra cada tantos registros por fragmento (0: sin muestreo)
+    std::vector<PerfilTipo> tipos;
+    std::vector<SitioAsignacion> sitios;  // Ordenados de más a menos muestras
+};
+
+// Formato de salida de MPointerGC::dumpHeapProfile
+enum class FormatoPerfil {
+    Json,
+    Prometheus  // Formato de texto de exposición de Prometheus
+};
+
+// Qué escribe el GC por su cuenta
+enum class NivelRegistroGC {
+    Silencio,  // Nada (por defecto)
+    Ciclos,  // Un resumen en std::cout por cada runGC
+    Detalle  // Además, cada registro y eliminación en el trazador
+};
+
+// Evento guardado por el trazador
+struct EventoGC {
+    enum Tipo : std::uint8_t { Registro, Eliminacion, Ciclo };
+
+    Tipo tipo;
+    std::uint64_t handle;  // Handle del objeto (cantidad de objetos liberados en un Ciclo)
+    std::uint64_t bytes;
+    std::int64_t nanosegundos;  // Momento del evento, en el reloj monótono
+};
+
+// Búfer circular de eventos para depurar el GC sin escribir en el camino crítico.
+// Cualquier hilo agrega sin candados; cuando el búfer se llena se pisan los más viejos.
+// Un solo lector a la vez los vuelca a un flujo cuando le conviene.
+class TrazadorGC {
+public:
+    static constexpr std::uint64_t CAPACIDAD = 1u << 12;
+
+    void agregar(EventoGC::Tipo tipo, std::uint64_t handle, std::uint64_t bytes);
+
+    // Escribe en `salida` los eventos nuevos desde el último volcado; devuelve cuántos escribió
+    std::size_t volcar(std::ostream& salida);
+
+private:
+    // Cada campo es atómico para que el lector nunca lea un evento a medio escribir;
+    // `secuencia` vale la posición global + 1 una vez que el evento está completo.
+    struct Casilla {
+        std::atomic<std::uint64_t> secuencia{0};
+        std::atomic<std::uint8_t> tipo{0};
+        std::atomic<std::uint64_t> handle{0};
+        std::atomic<std::uint64_t> bytes{0};
+        std::atomic<std::int64_t> nanosegundos{0};
+    };
+
+    Casilla casillas[CAPACIDAD];
+    std::atomic<std::uint64_t> escritura{0};
+    std::uint64_t lectura = 0;
+    std::mutex mutexLectura;
+};
 
 class MPointerGC {
+    friend class Guarderia;
+
+public:
+    // Identificador estable de un puntero registrado.
+    // Los 32 bits bajos son el índice de la ranura, los 6 siguientes el fragmento del registro
+    // y los 26 altos la generación de la ranura, de modo que un handle de una ranura ya
+    // reutilizada nunca coincide con el nuevo ocupante.
+    using Handle = std::uint64_t;
+
+    // Handle que nunca se entrega (la generación de una ranura empieza en 1)
+    static constexpr Handle HANDLE_INVALIDO = 0;
+
+    // Cantidad de fragmentos del registro; cada hilo registra en uno propio
+    static constexpr unsigned CANTIDAD_FRAGMENTOS = 64;
+
+    // Sección en la que un hilo modifica MPointers mientras el recolector en segundo plano está activo
+    // Qué sucede: Toma el candado compartido de los mutadores; el recolector toma el exclusivo.
+    // Por qué sucede: El borrado de prueba necesita que los contadores no cambien mientras analiza.
+    // Qué deberíamos esperar: Varios hilos pueden estar dentro a la vez; un tramo del recolector espera
+    // a que todos salgan y, mientras dura (del orden de `pausaMaxima`), nadie entra. Sin NDEBUG, cambiar
+    // el contador o el registro de un MPointer rastreado fuera de una sección, con el recolector activo,
+    // falla en un assert (ver verificarMutador).
+    class SeccionMutador {
+    public:
+        SeccionMutador() : candado(MPointerGC::getInstance().mutexMutadores) {
+            seccionesDelHilo++;
+        }
+
+        ~SeccionMutador() {
+            seccionesDelHilo--;
+        }
+
+        SeccionMutador(const SeccionMutador&) = delete;
+        SeccionMutador& operator=(const SeccionMutador&) = delete;
+
+    private:
+        std::shared_lock<std::shared_mutex> candado;
+    };
+
+    // Comprueba, sin NDEBUG, que el hilo que llama pueda cambiar contadores o el registro: con el
+    // recolector en segundo plano activo, solo dentro de una SeccionMutador o desde una recolección,
+    // que libera la basura con los mutadores detenidos. Con NDEBUG no queda ninguna instrucción.
+    static void verificarMutador() noexcept {
+        assert((!instance.fondoActivo.load(std::memory_order_relaxed) || seccionesDelHilo > 0)
+               && "Con el recolector en segundo plano activo, los MPointers rastreados se usan dentro de una SeccionMutador");
+    }
+
 private:
     static MPointerGC instance;  // Singleton para gestionar los MPointers
-    std::list<void*> pointerList;  // Lista de punteros registrados
+
+    static constexpr std::uint32_t SIN_RANURA = 0xFFFFFFFFu;
+    static constexpr unsigned BITS_FRAGMENTO = 6;
+    static constexpr std::uint32_t MASCARA_GENERACION = (1u << 26) - 1;
+    static constexpr std::size_t BYTES_POR_AVISO = 64u << 10;  // Granularidad del aviso de presión
+
+    // Ranura de la tabla: si está ocupada, `posicion` indica dónde vive su entrada en `vivos`;
+    // si está libre, `posicion` enlaza con la siguiente ranura libre.
+    struct Ranura {
+        std::uint32_t generacion;
+        std::uint32_t posicion;
+    };
+
+    // Entrada densa de un bloque vivo y la ranura que la referencia
+    struct Entrada {
+        BloqueControl* bloque;
+        std::uint32_t ranura;
+    };
+
+    static constexpr std::uint32_t SIN_MUESTREO = 0xFFFFFFFFu;
+    static constexpr int MARCOS_POR_MUESTRA = 8;  // Profundidad de la pila guardada en cada muestra
+
+    // Asignaciones muestreadas desde una misma pila con las mismas operaciones
+    struct MuestraSitio {
+        const OperacionesBloque* ops;
+        void* marcos[MARCOS_POR_MUESTRA];
+        int profundidad;
+        std::uint64_t muestras;
+    };
+
+    // Porción independiente del registro, con su propio candado.
+    // Alineada a línea de caché para que los hilos no compartan líneas entre fragmentos.
+    struct alignas(64) Fragmento {
+        std::mutex mutex;
+        std::vector<Ranura> ranuras;  // Tabla de ranuras indexada por el handle
+        std::vector<Entrada> vivos;  // Bloques registrados, contiguos y sin huecos
+        std::uint32_t primeraLibre = SIN_RANURA;  // Cabeza de la lista de ranuras libres
+        std::size_t bytesSinAvisar = 0;  // Bytes registrados aún no sumados a la presión global
+        std::int64_t bytesSinPublicar = 0;  // Cambio de bytes vivos aún no sumado al total global
+
+        // Contadores escritos solo con el candado tomado (sin instrucciones bloqueantes) y leídos sin él
+        std::atomic<std::uint64_t> registros{0};
+        std::atomic<std::uint64_t> eliminaciones{0};
+        std::atomic<std::uint64_t> bytesVivos{0};
+
+        // Registros que faltan para la próxima muestra; sin muestreo, el máximo, para que el camino
+        // crítico sea un decremento y no tenga que leer el intervalo.
+        std::uint32_t hastaMuestra = SIN_MUESTREO;
+    };
+
+    Fragmento fragmentos[CANTIDAD_FRAGMENTOS];
+
+    // Exclusión entre el recolector (exclusivo) y las secciones de los mutadores (compartido)
+    std::shared_mutex mutexMutadores;
+
+    // Secciones abiertas por el hilo; una recolección cuenta como una mientras detiene a los mutadores
+    static inline thread_local unsigned seccionesDelHilo = 0;
+
+    // Candado exclusivo de una recolección: detiene a los mutadores y habilita al hilo del recolector,
+    // que al liberar la basura suelta referencias de objetos vivos
+    class MundoDetenido {
+    public:
+        explicit MundoDetenido(std::shared_mutex& mutex) : candado(mutex) {
+            seccionesDelHilo++;
+        }
+
+        ~MundoDetenido() {
+            seccionesDelHilo--;
+        }
+
+    private:
+        std::unique_lock<std::shared_mutex> candado;
+    };
+
+    // Posición del próximo tramo incremental dentro del registro
+    unsigned cursorFragmento = 0;
+    std::size_t cursorPosicion = 0;
+    std::uint8_t marcaVuelta = 0;  // Marca que dejan los analizados en la vuelta actual del cursor
+    double nanosegundosPorObjeto = 50.0;  // Costo medido de analizar un objeto, para dimensionar los tramos
+
+    // Recolector en segundo plano
+    std::thread hiloFondo;
+    std::mutex mutexFondo;
+    std::condition_variable despertarFondo;
+    bool detenerFondo = false;
+    std::atomic<bool> fondoActivo{false};
+    ConfiguracionGC configuracion;  // Se lee y se escribe con mutexFondo tomado
+    std::atomic<std::size_t> umbralActivacion{0};  // Copia de `bytesParaActivar`, para leerla sin mutexFondo
+    std::atomic<std::size_t> bytesDesdeUltimoCiclo{0};
+
+    HistogramaPausas histograma;
+
+    // Total global de bytes vivos, publicado de a BYTES_POR_AVISO, y su máximo
+    std::atomic<std::int64_t> bytesVivosPublicados{0};
+    std::atomic<std::int64_t> picoBytesVivos{0};
+
+    std::atomic<NivelRegistroGC> nivelRegistro{NivelRegistroGC::Silencio};
+    TrazadorGC trazador;
+
+    // Perfil del heap: las pilas muestreadas y la consulta anterior, para la tasa de asignación.
+    // mutexPerfil nunca se toma antes que el candado de un fragmento.
+    std::mutex mutexPerfil;
+    std::unordered_map<std::uint64_t, MuestraSitio> muestras;  // Por hash de la pila y las operaciones
+    std::uint32_t intervaloMuestreo = 0;  // Copiado a cada fragmento al cambiarlo
+    std::chrono::steady_clock::time_point consultaPerfil = std::chrono::steady_clock::now();
+    std::uint64_t asignacionesConsultadas = 0;
+
+    // Modo generacional: promociones y el comienzo del intervalo actual, que solo escribe el recolector
+    // con los mutadores detenidos; el último intervalo cerrado se publica para stats().
+    std::atomic<std::uint64_t> promovidos{0};
+    std::chrono::steady_clock::time_point inicioIntervalo = std::chrono::steady_clock::now();
+    std::uint64_t asignacionesAlIniciar = 0;
+    std::uint64_t jovenesAlIniciar = 0;
+    std::atomic<double> asignacionesPorSegundo{0.0};
+    std::atomic<double> supervivencia{0.0};
 
     // Constructor privado para implementar el patrón singleton
     MPointerGC() {}
+    ~MPointerGC();
+
+    // Fragmento asignado al hilo que llama
+    static unsigned fragmentoDelHilo();
+
+    // Devuelve la ranura que corresponde al handle dentro de su fragmento,
+    // o nullptr si el handle está vencido. Requiere tener el candado del fragmento.
+    static Ranura* buscarRanura(Fragmento& fragmento, Handle id);
+
+    // Fragmento al que pertenece un handle
+    Fragmento& fragmentoDe(Handle id);
+
+    // Agrega la entrada de un bloque y devuelve su handle, sin contar sus bytes.
+    // Requiere tener el candado del fragmento. Una promoción no es un sitio de asignación: no se muestrea.
+    Handle agregarEntrada(Fragmento& fragmento, unsigned numero, BloqueControl* bloque, bool muestrear = true);
+
+    // Elimina la entrada de un handle. Requiere tener el candado del fragmento.
+    void eliminarEntrada(Fragmento& fragmento, Handle id);
+
+    // Acumula un cambio de bytes vivos del fragmento y actualiza el pico al publicarlo
+    void contarBytes(Fragmento& fragmento, std::int64_t bytes);
+
+    // Indica si el nivel de registro actual incluye `nivel`
+    bool registra(NivelRegistroGC nivel) const;
+
+    // Guarda la pila de llamadas de un registro muestreado y reinicia la cuenta del fragmento
+    void muestrearSitio(Fragmento& fragmento, const OperacionesBloque* ops);
+
+    // Suma bytes a la presión de asignación y despierta al recolector si corresponde
+    void avisarPresion(Fragmento& fragmento, std::size_t bytes);
+
+    // Lo mismo para los bytes de un trozo de la guardería que un hilo terminó de llenar
+    void avisarPresionJoven(std::size_t bytes);
+
+    // Despierta al recolector en segundo plano si `total` llegó al umbral de activación
+    void despertarSiHayPresion(std::size_t total);
+
+    // Agrega a `conjunto`, como tentativos, los objetos jóvenes vivos de todos los trozos de la guardería.
+    // Requiere todos los candados tomados y los mutadores detenidos.
+    void agregarJovenes(std::vector<BloqueControl*>& conjunto);
+
+    // Registra los jóvenes de conjunto[desde..] que sobrevivieron al análisis. Requiere todos los candados.
+    void promoverJovenes(const std::vector<BloqueControl*>& conjunto, std::size_t desde, ResultadoGC& resultado);
+
+    // Cierra el intervalo de asignación en una recolección que promovió `promovidosEnCiclo` jóvenes
+    void cerrarIntervalo(std::size_t promovidosEnCiclo);
+
+    // Escribe el resumen de una recolección si el nivel de registro lo pide
+    void informarCiclo(const ResultadoGC& resultado);
+
+    // Borrado de prueba sobre un conjunto de bloques marcados como tentativos.
+    // Deja en `basura` los inalcanzables, ya fijados y fuera del registro, y a los demás con `marcaFinal`.
+    void analizarConjunto(std::vector<BloqueControl*>& conjunto, std::vector<BloqueControl*>& basura,
+                          std::uint8_t marcaFinal);
+
+    // Destruye y libera la basura encontrada, completando el resultado
+    static void liberarBasura(std::vector<BloqueControl*>& basura, ResultadoGC& resultado);
+
+    // Un tramo incremental; devuelve true si el cursor completó una vuelta al registro
+    bool tramo(std::chrono::nanoseconds presupuesto, ResultadoGC& resultado);
+
+    // Un tramo con los mutadores detenidos, que registra su pausa y ajusta el costo por objeto
+    bool tramoMedido(std::chrono::nanoseconds presupuesto, ResultadoGC& resultado);
+
+    // Bucle del hilo en segundo plano
+    void bucleFondo();
 
 public:
     // Método estático para obtener la instancia única
     static MPointerGC& getInstance();
 
-    // Registrar un nuevo MPointer
-    int registerPointer(void* ptr);
+    // Registrar un nuevo MPointer en O(1); devuelve su handle.
+    // Seguro entre hilos: cada hilo registra en su propio fragmento.
+    Handle registerPointer(BloqueControl* bloque);
+
+    // Registrar `cantidad` bloques con una sola toma de candado; deja el handle de cada uno en su `id`.
+    // Para construcciones en lote, donde un registro por objeto dominaría el costo.
+    void registerBatch(BloqueControl* const* bloques, std::size_t cantidad);
+
+    // Eliminar un MPointer cuando ya no es necesario, en O(1), desde cualquier hilo.
+    // Un handle vencido o inválido se ignora.
+    void deregisterPointer(Handle id);
+
+    // Indica si el handle pertenece a un puntero que sigue registrado
+    bool isRegistered(Handle id);
+
+    // Devuelve el bloque registrado con el handle, o nullptr si ya no existe
+    BloqueControl* getPointer(Handle id);
+
+    // Cantidad de punteros registrados actualmente
+    std::size_t size();
+
+    // Método para ejecutar el Garbage Collector (GC)
+    // Libera los ciclos de objetos que ya no son alcanzables desde fuera del registro
+    // (por ejemplo, los nodos de una ListaDoble destruida). Detiene a los mutadores mientras
+    // analiza: no debe llamarse desde dentro de una SeccionMutador.
+    // Analiza también los objetos jóvenes y promueve a los que sobreviven.
+    ResultadoGC runGC();
+
+    // Recolección menor del modo generacional
+    // Qué sucede: Analiza solo los objetos jóvenes vivos, libera los ciclos que forman entre ellos y
+    // registra (promueve) a los sobrevivientes.
+    // Por qué sucede: Los jóvenes que siguen vivos son pocos; la pausa depende de ellos y de la cantidad
+    // de trozos, no del tamaño del registro.
+    // Qué deberíamos esperar: Un joven referenciado desde un objeto registrado sobrevive aunque los dos
+    // formen un ciclo basura; ese ciclo lo libera el próximo runGC. Como runGC, no debe llamarse desde
+    // dentro de una SeccionMutador.
+    ResultadoGC runMinorGC();
+
+    // Ejecuta un tramo incremental acotado por `presupuesto`
+    // Analiza los siguientes objetos del registro junto con lo que alcanzan, hasta la cantidad que
+    // entra en el presupuesto, así que un ciclo más chico que eso se libera completo en el tramo que lo
+    // encuentra. Una estructura conexa más grande se analiza de a partes en varios tramos, que no
+    // pueden liberarla si es basura: el tramo lo indica con `estructuraCortada` y quien lo llama decide
+    // cuándo pagar un runGC. El recolector en segundo plano lo hace solo (ver startBackgroundGC).
+    ResultadoGC runGCSlice(std::chrono::nanoseconds presupuesto);
+
+    // Inicia el hilo que recolecta en tramos cuando hay presión de asignación o cada `intervalo`
+    // Si una vuelta disparada por presión cortó alguna estructura, el hilo sigue con un runGC: la basura
+    // más grande que un tramo no se acumula. Mientras lo cortado resulte vivo, se escala de nuevo solo
+    // cuando los bytes vivos crecen `bytesParaActivar`.
+    void startBackgroundGC(const ConfiguracionGC& config = ConfiguracionGC());
+
+    // Detiene y espera al hilo en segundo plano
+    void stopBackgroundGC();
+
+    // Percentiles de las pausas de runGC y de los tramos
+    EstadisticasPausas pauseStats() const;
+
+    // Olvida las pausas registradas hasta ahora
+    void resetPauseStats();
+
+    // Contadores del registro
+    // Qué sucede: Suma los contadores de cada fragmento sin tomar ningún candado.
+    // Por qué sucede: Así se pueden consultar periódicamente sin frenar a los mutadores.
+    // Qué deberíamos esperar: Valores exactos si nadie registra a la vez; si no, una foto aproximada.
+    // El pico se publica de a 64 KiB por fragmento, así que puede quedar por debajo del real en esa medida.
+    EstadisticasGC stats() const;
+
+    // Modo generacional
+    // Qué sucede: Con el modo activo, MPointer::New crea los objetos rastreados en la guardería del hilo
+    // (ver Guarderia.h), sin registrarlos. Cada recolección analiza los jóvenes vivos y registra a los
+    // que sobreviven; la vuelta del recolector en segundo plano lo hace al empezar.
+    // Por qué sucede: Un temporal que muere antes de la próxima recolección se ahorra el registro y la
+    // eliminación, y su memoria se reutiliza sin pasar por ninguna lista de libres.
+    // Qué deberíamos esperar: Mientras es joven, un objeto no cuenta en size(), en heapProfile() ni en los
+    // contadores del registro, y su getId() es HANDLE_INVALIDO. Los que ya nacieron jóvenes se siguen
+    // recolectando y promoviendo aunque el modo se desactive. Para las políticas no rastreadas, los objetos
+    // intrusivos, NewEn y NewLote no cambia nada.
+    void setGenerationalMode(bool activo);
+
+    // Nivel de registro: por defecto el GC no escribe nada
+    void setLogLevel(NivelRegistroGC nivel);
+
+    // Vuelca a `salida` los eventos trazados con NivelRegistroGC::Detalle; devuelve cuántos escribió
+    std::size_t dumpTrace(std::ostream& salida);
+
+    // Perfil del heap por tipo
+    // Qué sucede: Recorre los bloques vivos de cada fragmento (tomando su candado de a uno) y los agrupa
+    // por el tipo de sus operaciones; un objeto en línea y uno adoptado con `new` suman al mismo tipo.
+    // Por qué sucede: Cada bloque lleva en sus operaciones el tipo y el tamaño del objeto, así que el
+    // registro no necesita contar nada por tipo y registrar cuesta lo mismo que sin perfil.
+    // Qué deberíamos esperar: Objetos y bytes vivos exactos por tipo en el momento de leer cada fragmento,
+    // y la tasa de asignación desde la consulta anterior. Cada fragmento queda detenido mientras se
+    // recorre (unos milisegundos por millón de objetos). Compilado con MPOINTERGC_SIN_PERFIL, el perfil
+    // vuelve vacío con `habilitado` en false.
+    PerfilHeap heapProfile();
 
-    // Eliminar un MPointer cuando ya no es necesario
-    void deregisterPointer(void* ptr);
+    // Escribe heapProfile() en `salida` como JSON o como texto de Prometheus
+    void dumpHeapProfile(std::ostream& salida, FormatoPerfil formato = FormatoPerfil::Json);
 
-    // Método para ejecutar el Garbage Collector (GC) si es necesario
-    void runGC();
+    // Guarda la pila de llamadas de uno de cada `cadaN` registros de cada fragmento (0 lo desactiva).
+    // Capturar la pila cuesta microsegundos: con `cadaN` de algunos miles no se nota en el total.
+    // Las pilas se ven con nombres si el ejecutable se enlaza con -rdynamic; si no, como módulo+desplazamiento.
+    void setAllocationSampling(std::uint32_t cadaN);
 };
 
 #endif
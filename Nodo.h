@@ -1,20 +1,53 @@
 #ifndef NODO_H
 #define NODO_H
 
+#include <type_traits>
+#include <utility>
 #include "MPointer.h"
 
-template <typename T>
-class Nodo {
+// Nodo de una lista doblemente enlazada
+// Con una política intrusiva (PoliticaIntrusiva) el nodo hereda su propio contador y cada enlace
+// ocupa un solo puntero; con la política por defecto, el contador va en un bloque junto al nodo.
+// Con PoliticaAnteriorDebil, `anterior` no cuenta como referencia y los nodos no forman ciclos.
+template <typename T, typename Politica = PoliticaPorDefecto>
+class Nodo : public BaseSegunPolitica<Politica> {
 public:
-    T data;                      // Valor almacenado en el nodo
-    MPointer<Nodo<T>> siguiente;  // Puntero al siguiente nodo
-    MPointer<Nodo<T>> anterior;   // Puntero al nodo anterior
+    using EnlaceAnterior = std::conditional_t<Politica::anteriorDebil, MWeakPointer<Nodo, Politica>, MPointer<Nodo, Politica>>;
+
+    T data;                              // Valor almacenado en el nodo
+    MPointer<Nodo, Politica> siguiente;  // Puntero al siguiente nodo
+    EnlaceAnterior anterior;             // Puntero al nodo anterior
 
     // Constructor por defecto
     Nodo() : data(T()), siguiente(nullptr), anterior(nullptr) {}
 
     // Constructor que inicializa el valor del nodo
     Nodo(T valor) : data(valor), siguiente(nullptr), anterior(nullptr) {}
+
+    // Constructor que construye el valor en el lugar con `args`
+    template <typename... Args>
+    explicit Nodo(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...), siguiente(nullptr), anterior(nullptr) {}
+};
+
+// Enlace entre nodos y vista de un nodo, con la política de la lista
+template <typename T, typename Politica = PoliticaPorDefecto>
+using EnlaceNodo = MPointer<Nodo<T, Politica>, Politica>;
+
+template <typename T, typename Politica = PoliticaPorDefecto>
+using VistaNodo = MPointerVista<Nodo<T, Politica>, Politica>;
+
+// Enlaces que el Garbage Collector recorre para detectar los ciclos siguiente/anterior
+// Un `anterior` débil no suma al contador del nodo, así que no se visita.
+template <typename T, typename Politica>
+struct TrazadoMPointer<Nodo<T, Politica>> {
+    static constexpr bool tieneReferencias = true;
+
+    static void trazar(const Nodo<T, Politica>& nodo, const VisitanteGC& visitar) {
+        visitar(nodo.siguiente);
+        if constexpr (!Politica::anteriorDebil) {
+            visitar(nodo.anterior);
+        }
+    }
 };
 
 #endif
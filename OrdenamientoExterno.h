@@ -0,0 +1,359 @@
+#ifndef ORDENAMIENTOEXTERNO_H
+#define ORDENAMIENTOEXTERNO_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "InstantaneaLista.h"
+
+// Ordenamiento externo: para datos que no entran en memoria
+// Qué sucede: Los valores entran por partes a un búfer del tamaño del presupuesto de memoria; cada
+// búfer lleno se ordena y se vuelca a un archivo temporal (un tramo). Al final, los tramos se mezclan
+// de a k con un árbol de perdedores, leyendo y escribiendo por búferes grandes y secuenciales.
+// Por qué sucede: Los algoritmos de sorting.h necesitan todos los nodos en memoria a la vez.
+// Qué deberíamos esperar: Memoria acotada por `bytesMemoria` más los búferes de E/S, sin importar la
+// cantidad de valores. Si todo entra en un solo tramo no se escribe ningún archivo. El orden no es
+// estable: los tramos se ordenan con std::sort.
+
+// Opciones de un ordenamiento externo
+struct OpcionesOrdenExterno {
+    std::size_t bytesMemoria = 256u << 20;  // Tamaño de cada tramo en memoria
+    std::size_t bytesBufer = 1u << 20;  // Búfer de cada archivo durante la mezcla
+    std::string directorioTemporal;  // Donde van los tramos; vacío: $TMPDIR o /tmp
+};
+
+// Lo que hizo un ordenamiento externo
+struct ResultadoOrdenExterno {
+    std::uint64_t valores = 0;  // Valores ordenados
+    std::uint64_t tramos = 0;  // Tramos volcados a disco (0 si todo entró en memoria)
+    std::uint64_t pasadasMezcla = 0;  // Mezclas de tramos intermedias, antes de la final
+    std::uint64_t bytesLeidos = 0;  // E/S de los archivos temporales
+    std::uint64_t bytesEscritos = 0;
+    std::size_t bytesValor = 0;  // sizeof(T)
+    double segundos = 0;  // Desde el primer valor hasta el último entregado
+
+    // Rendimiento en MB/s (10^6 bytes) de datos ordenados
+    double megabytesPorSegundo() const {
+        return segundos > 0 ? static_cast<double>(valores) * bytesValor / 1e6 / segundos : 0;
+    }
+};
+
+namespace detalle {
+
+// Árbol de perdedores sobre k fuentes ordenadas
+// Cada nodo interno guarda la fuente que perdió allí; la raíz (posición 0) guarda la ganadora. Al
+// avanzar la ganadora basta rejugar su camino a la raíz: log2(k) comparaciones, contra
+// 2 log2(k) de un montículo. `gana(a, b)` dice si la fuente `a` va antes que `b`.
+template <typename Gana>
+class ArbolPerdedores {
+public:
+    ArbolPerdedores(std::size_t fuentes, Gana gana) : arbol(fuentes), fuentes(fuentes), gana(std::move(gana)) {
+        arbol[0] = jugar(1);
+    }
+
+    std::size_t ganadora() const {
+        return arbol[0];
+    }
+
+    // Rejuega el camino de la ganadora después de que cambió su valor
+    void reajustar() {
+        std::size_t ganadora = arbol[0];
+        for (std::size_t nodo = (ganadora + fuentes) / 2; nodo > 0; nodo /= 2) {
+            if (gana(arbol[nodo], ganadora)) {
+                std::swap(arbol[nodo], ganadora);
+            }
+        }
+        arbol[0] = ganadora;
+    }
+
+private:
+    std::vector<std::size_t> arbol;
+    std::size_t fuentes;
+    Gana gana;
+
+    // Las hojas son las posiciones fuentes..2*fuentes-1; devuelve la ganadora del subárbol
+    std::size_t jugar(std::size_t nodo) {
+        if (nodo >= fuentes) {
+            return nodo - fuentes;
+        }
+        std::size_t izquierda = jugar(2 * nodo);
+        std::size_t derecha = jugar(2 * nodo + 1);
+        if (gana(izquierda, derecha)) {
+            arbol[nodo] = derecha;
+            return izquierda;
+        }
+        arbol[nodo] = izquierda;
+        return derecha;
+    }
+};
+
+}  // namespace detalle
+
+// Ordenador externo de valores trivialmente copiables
+// Qué sucede: `agregar` acumula valores y vuelca tramos ordenados; `volcar` entrega todos los valores
+// en orden, por bloques, a un destino `destino(const T* valores, std::size_t cantidad)`.
+// Por qué sucede: Separar la entrada del destino permite ordenar desde cualquier rango hacia una
+// lista, una instantánea u otro consumidor, sin tener nunca todos los valores en memoria.
+// Qué deberíamos esperar: Si hay más tramos que los que caben en una mezcla (bytesMemoria / bytesBufer),
+// se mezclan por grupos en tramos más largos antes de la mezcla final. Los archivos temporales se
+// borran al terminar, o en el destructor si algo falla.
+template <typename T, typename Comparador = std::less<T>>
+class OrdenadorExterno {
+    static_assert(std::is_trivially_copyable<T>::value, "Los tramos se escriben byte a byte: T debe ser trivialmente copiable");
+
+public:
+    explicit OrdenadorExterno(OpcionesOrdenExterno opciones = {}, Comparador comparar = {})
+        : opciones(std::move(opciones)), comparar(std::move(comparar)) {
+        if (this->opciones.directorioTemporal.empty()) {
+            const char* variable = std::getenv("TMPDIR");
+            this->opciones.directorioTemporal = variable != nullptr && *variable != '\0' ? variable : "/tmp";
+        }
+        this->opciones.bytesBufer = std::max(this->opciones.bytesBufer, sizeof(T));
+        capacidadTramo = std::max<std::size_t>(1, this->opciones.bytesMemoria / sizeof(T));
+        resultado.bytesValor = sizeof(T);
+    }
+
+    OrdenadorExterno(const OrdenadorExterno&) = delete;
+    OrdenadorExterno& operator=(const OrdenadorExterno&) = delete;
+
+    ~OrdenadorExterno() {
+        for (const std::string& archivo : archivos) {
+            std::remove(archivo.c_str());  // Los ya mezclados no existen; el error se ignora.
+        }
+    }
+
+    void agregar(const T& valor) {
+        if (resultado.valores == 0) {
+            inicio = std::chrono::steady_clock::now();
+        }
+        if (bufer.size() == capacidadTramo) {
+            volcarTramo();
+        } else if (bufer.size() == bufer.capacity()) {  // Crece sin pasarse del presupuesto.
+            bufer.reserve(std::min(capacidadTramo, std::max<std::size_t>(1024, 2 * bufer.capacity())));
+        }
+        bufer.push_back(valor);
+        resultado.valores++;
+    }
+
+    template <typename Iterador>
+    void agregarRango(Iterador primero, Iterador ultimo) {
+        for (; primero != ultimo; ++primero) {
+            agregar(*primero);
+        }
+    }
+
+    // Entrega los valores ordenados a `destino` por bloques de hasta bytesBufer bytes
+    // Solo se puede llamar una vez.
+    template <typename Destino>
+    void volcar(Destino destino) {
+        if (tramos.empty()) {  // Todo entró en memoria.
+            std::sort(bufer.begin(), bufer.end(), comparar);
+            const std::size_t porBloque = valoresPorBufer();
+            for (std::size_t i = 0; i < bufer.size(); i += porBloque) {
+                destino(bufer.data() + i, std::min(porBloque, bufer.size() - i));
+            }
+        } else {
+            if (!bufer.empty()) {
+                volcarTramo();
+            }
+            std::vector<T>().swap(bufer);  // La memoria del tramo pasa a los búferes de la mezcla.
+            const std::size_t maximoPorMezcla = std::max<std::size_t>(2, opciones.bytesMemoria / opciones.bytesBufer);
+            while (tramos.size() > maximoPorMezcla) {
+                std::vector<Tramo> grupo(tramos.begin(), tramos.begin() + maximoPorMezcla);
+                tramos.erase(tramos.begin(), tramos.begin() + maximoPorMezcla);
+                Tramo mezclado = nuevoTramo();
+                EscritorInstantanea escritor(mezclado.ruta, opciones.bytesBufer);
+                mezclar(grupo, [&](const T* valores, std::size_t cantidad) {
+                    escritor.escribir(valores, cantidad * sizeof(T));
+                    mezclado.cantidad += cantidad;
+                });
+                escritor.cerrar();
+                resultado.bytesEscritos += mezclado.cantidad * sizeof(T);
+                tramos.push_back(std::move(mezclado));  // Al final: los tramos se mezclan por orden de llegada.
+                resultado.pasadasMezcla++;
+            }
+            mezclar(tramos, destino);
+            tramos.clear();
+        }
+        resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    }
+
+    const ResultadoOrdenExterno& estadisticas() const {
+        return resultado;
+    }
+
+private:
+    // Un tramo ordenado en disco
+    struct Tramo {
+        std::string ruta;
+        std::uint64_t cantidad = 0;
+    };
+
+    // Lectura de un tramo durante la mezcla
+    struct Lectura {
+        LectorInstantanea lector;
+        std::uint64_t restantes;
+        T actual;
+        bool agotada = false;
+
+        Lectura(const Tramo& tramo, std::size_t bytesBufer) : lector(tramo.ruta, bytesBufer), restantes(tramo.cantidad) {
+            avanzar();
+        }
+
+        void avanzar() {
+            if (restantes == 0) {
+                agotada = true;
+                return;
+            }
+            actual = lector.leerValor<T>();
+            restantes--;
+        }
+    };
+
+    OpcionesOrdenExterno opciones;
+    Comparador comparar;
+    std::size_t capacidadTramo;
+    std::vector<T> bufer;
+    std::vector<Tramo> tramos;  // Tramos pendientes de mezclar, en orden de creación
+    std::vector<std::string> archivos;  // Todos los archivos temporales creados, para borrarlos
+    ResultadoOrdenExterno resultado;
+    std::chrono::steady_clock::time_point inicio = std::chrono::steady_clock::now();
+
+    std::size_t valoresPorBufer() const {
+        return opciones.bytesBufer / sizeof(T);
+    }
+
+    Tramo nuevoTramo() {
+        std::string plantilla = opciones.directorioTemporal + "/mpointer_tramo_XXXXXX";
+        int descriptor = ::mkstemp(&plantilla[0]);
+        if (descriptor < 0) {
+            throw std::system_error(errno, std::generic_category(), "No se pudo crear un tramo en " + opciones.directorioTemporal);
+        }
+        ::close(descriptor);
+        archivos.push_back(plantilla);
+        Tramo tramo;
+        tramo.ruta = std::move(plantilla);
+        return tramo;
+    }
+
+    void volcarTramo() {
+        std::sort(bufer.begin(), bufer.end(), comparar);
+        Tramo tramo = nuevoTramo();
+        EscritorInstantanea escritor(tramo.ruta, 0);  // El tramo completo va directo al archivo.
+        escritor.escribir(bufer.data(), bufer.size() * sizeof(T));
+        escritor.cerrar();
+        tramo.cantidad = bufer.size();
+        tramos.push_back(std::move(tramo));
+        resultado.tramos++;
+        resultado.bytesEscritos += bufer.size() * sizeof(T);
+        bufer.clear();
+    }
+
+    // Mezcla los tramos de `grupo` hacia `destino` y borra sus archivos
+    template <typename Destino>
+    void mezclar(const std::vector<Tramo>& grupo, Destino&& destino) {
+        std::vector<std::unique_ptr<Lectura>> lecturas;
+        std::uint64_t total = 0;
+        for (const Tramo& tramo : grupo) {
+            lecturas.push_back(std::make_unique<Lectura>(tramo, opciones.bytesBufer));
+            total += tramo.cantidad;
+        }
+        // Un tramo agotado pierde contra cualquier otro.
+        auto gana = [&](std::size_t a, std::size_t b) {
+            const Lectura& primera = *lecturas[a];
+            const Lectura& segunda = *lecturas[b];
+            if (primera.agotada || segunda.agotada) {
+                return !primera.agotada;
+            }
+            return comparar(primera.actual, segunda.actual);
+        };
+        detalle::ArbolPerdedores<decltype(gana)> arbol(lecturas.size(), gana);
+
+        std::vector<T> salida;
+        salida.reserve(valoresPorBufer());
+        for (std::uint64_t i = 0; i < total; i++) {
+            Lectura& ganadora = *lecturas[arbol.ganadora()];
+            salida.push_back(ganadora.actual);
+            if (salida.size() == salida.capacity()) {
+                destino(salida.data(), salida.size());
+                salida.clear();
+            }
+            ganadora.avanzar();
+            arbol.reajustar();
+        }
+        if (!salida.empty()) {
+            destino(salida.data(), salida.size());
+        }
+        resultado.bytesLeidos += total * sizeof(T);
+        lecturas.clear();
+        for (const Tramo& tramo : grupo) {
+            std::remove(tramo.ruta.c_str());
+        }
+    }
+};
+
+// Función para ordenar un rango hacia una lista
+// Qué sucede: Ordena [primero, ultimo) con un OrdenadorExterno y agrega los valores ordenados al
+// final de `salida` con agregarRango, por bloques.
+// Por qué sucede: La entrada se lee una sola vez, así que puede venir de una fuente más grande que la
+// memoria (un flujo, una instantánea mapeada, otra lista).
+// Qué deberíamos esperar: `salida` termina con los valores en orden; devuelve las estadísticas,
+// con el rendimiento en MB/s.
+template <typename Iterador, typename T, typename Politica, typename Comparador = std::less<T>>
+ResultadoOrdenExterno ordenarExterno(Iterador primero, Iterador ultimo, ListaDoble<T, Politica>& salida,
+                                     OpcionesOrdenExterno opciones = {}, Comparador comparar = {}) {
+    OrdenadorExterno<T, Comparador> ordenador(std::move(opciones), std::move(comparar));
+    ordenador.agregarRango(primero, ultimo);
+    ordenador.volcar([&](const T* valores, std::size_t cantidad) { salida.agregarRango(valores, valores + cantidad); });
+    return ordenador.estadisticas();
+}
+
+// Función para ordenar un rango hacia una instantánea
+// Qué sucede: Igual que la versión para listas, pero los valores ordenados se escriben en `rutaSalida`.
+// Por qué sucede: Con datos más grandes que la memoria, la salida tampoco puede ser una lista.
+// Qué deberíamos esperar: Una instantánea plana que InstantaneaMapeada o cargarInstantanea leen en orden.
+template <typename Iterador, typename Comparador = std::less<typename std::iterator_traits<Iterador>::value_type>>
+ResultadoOrdenExterno ordenarExterno(Iterador primero, Iterador ultimo, const std::string& rutaSalida,
+                                     OpcionesOrdenExterno opciones = {}, Comparador comparar = {}) {
+    using T = typename std::iterator_traits<Iterador>::value_type;
+    OrdenadorExterno<T, Comparador> ordenador(std::move(opciones), std::move(comparar));
+    ordenador.agregarRango(primero, ultimo);
+    detalle::escribirInstantanea<T>(rutaSalida, [&](EscritorInstantanea& escritor) {
+        ordenador.volcar([&](const T* valores, std::size_t cantidad) { escritor.escribir(valores, cantidad * sizeof(T)); });
+        return ordenador.estadisticas().valores;
+    });
+    return ordenador.estadisticas();
+}
+
+// Función para ordenar una instantánea plana en otra
+// Qué sucede: Lee `rutaEntrada` de una sola pasada, por búfer, y escribe los valores ordenados en `rutaSalida`.
+// Por qué sucede: Es el caso de un conjunto de datos que nunca entra completo en memoria.
+// Qué deberíamos esperar: La memoria usada depende de `opciones`, no del tamaño de los archivos.
+template <typename T, typename Comparador = std::less<T>>
+ResultadoOrdenExterno ordenarInstantanea(const std::string& rutaEntrada, const std::string& rutaSalida,
+                                         OpcionesOrdenExterno opciones = {}, Comparador comparar = {}) {
+    OrdenadorExterno<T, Comparador> ordenador(opciones, std::move(comparar));
+    {
+        LectorInstantanea lector(rutaEntrada, opciones.bytesBufer);
+        CabeceraInstantanea cabecera = detalle::abrirInstantanea<T>(lector, rutaEntrada);
+        for (std::uint64_t i = 0; i < cabecera.cantidad; i++) {
+            ordenador.agregar(lector.leerValor<T>());
+        }
+    }
+    detalle::escribirInstantanea<T>(rutaSalida, [&](EscritorInstantanea& escritor) {
+        ordenador.volcar([&](const T* valores, std::size_t cantidad) { escritor.escribir(valores, cantidad * sizeof(T)); });
+        return ordenador.estadisticas().valores;
+    });
+    return ordenador.estadisticas();
+}
+
+#endif
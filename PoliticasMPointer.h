@@ -0,0 +1,56 @@
+#ifndef POLITICASMPOINTER_H
+#define POLITICASMPOINTER_H
+
+#include <type_traits>
+
+// Atomicidad del contador para la política por defecto (opción MPOINTER_ATOMIC_REFCOUNT de CMake)
+#ifdef MPOINTER_ATOMIC_REFCOUNT
+constexpr bool CONTADOR_ATOMICO_POR_DEFECTO = true;
+#else
+constexpr bool CONTADOR_ATOMICO_POR_DEFECTO = false;
+#endif
+
+// Política de un MPointer, elegida al compilar
+// Qué sucede: Cada parámetro activa o quita una parte del costo de un MPointer.
+// Por qué sucede: No todos los punteros necesitan lo mismo: un contenedor usado en un solo hilo y sin
+// ciclos no necesita el registro del GC ni instrucciones atómicas.
+// Qué deberíamos esperar: Lo que una política desactiva no deja ninguna instrucción en el código generado.
+//  - Rastreado: el objeto se registra en MPointerGC, que puede liberar sus ciclos.
+//  - Atomico: el contador se actualiza con operaciones atómicas, para compartir el objeto entre hilos.
+//  - Intrusivo: el contador vive dentro del objeto (T hereda de ObjetoIntrusivo) y el MPointer
+//    guarda un solo puntero; si no, guarda también el puntero a un bloque de control externo a T.
+//  - AnteriorDebil: en los nodos de ListaDoble, `anterior` es un MWeakPointer. Sin ciclos entre nodos,
+//    el conteo de referencias alcanza para liberar la lista; no se combina con Intrusivo.
+template <bool Rastreado, bool Atomico, bool Intrusivo, bool AnteriorDebil = false>
+struct PoliticaMPointer {
+    static_assert(!(Intrusivo && AnteriorDebil), "Un objeto intrusivo no admite referencias débiles");
+
+    static constexpr bool rastreado = Rastreado;
+    static constexpr bool atomico = Atomico;
+    static constexpr bool intrusivo = Intrusivo;
+    static constexpr bool anteriorDebil = AnteriorDebil;
+};
+
+// El comportamiento de siempre: registrado en el GC, contador externo
+using PoliticaPorDefecto = PoliticaMPointer<true, CONTADOR_ATOMICO_POR_DEFECTO, false>;
+
+// Para objetos que se comparten entre hilos
+using PoliticaCompartida = PoliticaMPointer<true, true, false>;
+
+// Sin GC ni atomicidad: lo más barato para objetos de un solo hilo que no forman ciclos
+using PoliticaLocal = PoliticaMPointer<false, false, false>;
+
+// Contador dentro del objeto, que debe heredar de ObjetoIntrusivo; el GC sigue rastreándolo
+using PoliticaIntrusiva = PoliticaMPointer<true, CONTADOR_ATOMICO_POR_DEFECTO, true>;
+
+// Listas sin ciclos: `anterior` débil, así que no hace falta el GC para liberarlas
+using PoliticaAnteriorDebil = PoliticaMPointer<false, CONTADOR_ATOMICO_POR_DEFECTO, false, true>;
+
+// Indica si un tipo es una PoliticaMPointer
+template <typename Politica>
+struct EsPoliticaMPointer : std::false_type {};
+
+template <bool Rastreado, bool Atomico, bool Intrusivo, bool AnteriorDebil>
+struct EsPoliticaMPointer<PoliticaMPointer<Rastreado, Atomico, Intrusivo, AnteriorDebil>> : std::true_type {};
+
+#endif
@@ -0,0 +1,149 @@
+#include "PoolTareas.h"
+
+namespace {
+// Pool y cola del hilo actual, si es un hilo de trabajo
+thread_local const PoolTareas* poolDelHilo = nullptr;
+thread_local unsigned colaPropia = 0;
+}
+
+// Constructor: crea las colas y después los hilos, que pueden robar de cualquiera
+PoolTareas::PoolTareas(unsigned hilos) {
+    if (hilos == 0) {
+        hilos = 1;
+    }
+    for (unsigned i = 0; i < hilos; i++) {
+        colas.push_back(std::make_unique<Cola>());
+    }
+    for (unsigned i = 0; i < hilos; i++) {
+        trabajadores.emplace_back(&PoolTareas::bucle, this, i);
+    }
+}
+
+// Destructor: los hilos terminan las tareas ya encoladas antes de salir
+PoolTareas::~PoolTareas() {
+    {
+        std::lock_guard<std::mutex> candado(mutexDormir);
+        detener = true;
+    }
+    despertar.notify_all();
+    for (std::thread& hilo : trabajadores) {
+        hilo.join();
+    }
+}
+
+unsigned PoolTareas::hilos() const {
+    return static_cast<unsigned>(trabajadores.size());
+}
+
+unsigned PoolTareas::colaDelHilo() const {
+    return poolDelHilo == this ? colaPropia : 0;
+}
+
+// Método para encolar una tarea
+void PoolTareas::enviar(std::function<void()> tarea) {
+    unsigned indice = poolDelHilo == this
+        ? colaPropia
+        : siguienteCola.fetch_add(1, std::memory_order_relaxed) % colas.size();
+    {
+        std::lock_guard<std::mutex> candado(colas[indice]->mutex);
+        colas[indice]->tareas.push_back(std::move(tarea));
+    }
+    pendientes.fetch_add(1, std::memory_order_release);
+    // Tomar el candado antes de avisar evita que un hilo se duerma justo después de ver 0 pendientes.
+    { std::lock_guard<std::mutex> candado(mutexDormir); }
+    despertar.notify_one();
+}
+
+// Método para tomar una tarea, propia o robada
+bool PoolTareas::tomar(unsigned propia, std::function<void()>& tarea) {
+    if (pendientes.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    for (unsigned i = 0; i < colas.size(); i++) {
+        Cola& cola = *colas[(propia + i) % colas.size()];
+        std::lock_guard<std::mutex> candado(cola.mutex);
+        if (cola.tareas.empty()) {
+            continue;
+        }
+        if (i == 0) {  // De la cola propia, la más reciente.
+            tarea = std::move(cola.tareas.back());
+            cola.tareas.pop_back();
+        } else {  // De otra cola, la más antigua: suele ser la de más trabajo.
+            tarea = std::move(cola.tareas.front());
+            cola.tareas.pop_front();
+        }
+        pendientes.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+// Método para ejecutar una tarea desde fuera del bucle (por ejemplo, mientras se espera un grupo)
+bool PoolTareas::ejecutarUna() {
+    std::function<void()> tarea;
+    if (!tomar(colaDelHilo(), tarea)) {
+        return false;
+    }
+    tarea();
+    return true;
+}
+
+// Bucle de cada hilo de trabajo
+void PoolTareas::bucle(unsigned indice) {
+    poolDelHilo = this;
+    colaPropia = indice;
+    std::function<void()> tarea;
+    while (true) {
+        if (tomar(indice, tarea)) {
+            tarea();
+            tarea = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> candado(mutexDormir);
+        despertar.wait(candado, [this] { return detener || pendientes.load(std::memory_order_acquire) > 0; });
+        if (detener && pendientes.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+// El grupo no puede destruirse con tareas que todavía lo referencian
+GrupoTareas::~GrupoTareas() {
+    while (pendientes.load(std::memory_order_acquire) > 0) {
+        if (!pool.ejecutarUna()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Método para enviar una tarea del grupo
+void GrupoTareas::enviar(std::function<void()> tarea) {
+    pendientes.fetch_add(1, std::memory_order_relaxed);
+    pool.enviar([this, tarea = std::move(tarea)] {
+        try {
+            tarea();
+        } catch (...) {
+            std::lock_guard<std::mutex> candado(mutexError);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        // Liberar publica los resultados de la tarea al hilo que espera.
+        pendientes.fetch_sub(1, std::memory_order_release);
+    });
+}
+
+// Método para esperar a las tareas del grupo, ayudando al pool mientras tanto
+void GrupoTareas::esperar() {
+    while (pendientes.load(std::memory_order_acquire) > 0) {
+        if (!pool.ejecutarUna()) {
+            std::this_thread::yield();
+        }
+    }
+    std::lock_guard<std::mutex> candado(mutexError);
+    if (error) {
+        std::exception_ptr relanzar = error;
+        error = nullptr;
+        std::rethrow_exception(relanzar);
+    }
+}
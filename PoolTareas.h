@@ -0,0 +1,84 @@
+#ifndef POOLTAREAS_H
+#define POOLTAREAS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool de hilos con robo de tareas
+// Qué sucede: Cada hilo tiene su propia cola. Toma sus tareas desde el final (las más recientes,
+// cuyos datos siguen en caché) y, cuando se queda sin trabajo, roba desde el frente de otra cola.
+// Por qué sucede: Las tareas que crean subtareas (como dividir y mezclar) quedan repartidas sin
+// una cola central por la que compitan todos los hilos.
+// Qué deberíamos esperar: Las tareas se ejecutan en cualquier hilo del pool, o en el hilo que
+// espera un GrupoTareas, que ayuda mientras espera.
+class PoolTareas {
+public:
+    // Crea `hilos` hilos de trabajo (al menos uno); por defecto, uno por núcleo
+    explicit PoolTareas(unsigned hilos = std::thread::hardware_concurrency());
+    ~PoolTareas();
+
+    PoolTareas(const PoolTareas&) = delete;
+    PoolTareas& operator=(const PoolTareas&) = delete;
+
+    // Cantidad de hilos de trabajo
+    unsigned hilos() const;
+
+    // Encola una tarea: en la cola propia si la llama un hilo del pool, si no en una cola rotativa
+    void enviar(std::function<void()> tarea);
+
+    // Ejecuta una tarea pendiente en el hilo que llama; devuelve false si no había ninguna
+    bool ejecutarUna();
+
+private:
+    // Cola de un hilo, alineada a línea de caché para no compartirla con las vecinas
+    struct alignas(64) Cola {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tareas;
+    };
+
+    std::vector<std::unique_ptr<Cola>> colas;
+    std::vector<std::thread> trabajadores;
+    std::atomic<std::size_t> pendientes{0};  // Tareas encoladas y aún no tomadas
+    std::atomic<unsigned> siguienteCola{0};
+    bool detener = false;
+    std::mutex mutexDormir;
+    std::condition_variable despertar;
+
+    // Toma una tarea: primero de la cola `propia` (por el final) y luego robando a las demás
+    bool tomar(unsigned propia, std::function<void()>& tarea);
+
+    // Índice de la cola del hilo que llama, o el de una cola cualquiera si no es del pool
+    unsigned colaDelHilo() const;
+
+    void bucle(unsigned indice);
+};
+
+// Conjunto de tareas que se esperan juntas
+// Qué sucede: Cuenta las tareas enviadas por este grupo y `esperar` vuelve cuando terminaron todas.
+// Por qué sucede: Mientras espera, el hilo ejecuta tareas del pool, así que una tarea puede crear
+// su propio grupo y esperarlo sin bloquear un hilo de trabajo.
+// Qué deberíamos esperar: Si alguna tarea lanza una excepción, `esperar` la relanza.
+class GrupoTareas {
+public:
+    explicit GrupoTareas(PoolTareas& pool) : pool(pool) {}
+    ~GrupoTareas();
+
+    void enviar(std::function<void()> tarea);
+    void esperar();
+
+private:
+    PoolTareas& pool;
+    std::atomic<std::size_t> pendientes{0};
+    std::mutex mutexError;
+    std::exception_ptr error;
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef LISTADEPRUEBA_H
+#define LISTADEPRUEBA_H
+
+#include <memory>
+#include <random>
+#include <vector>
+#include "ListaDoble.h"
+
+// Tipos de entrada para los algoritmos de ordenamiento
+enum class Entrada {
+    Aleatoria,
+    Ordenada,
+    Inversa,
+    Repetida  // Solo 16 valores distintos
+};
+
+// Lista de `n` nodos con valores aleatorios. Entre nodo y nodo se reservan otros objetos con `new`,
+// como haría un programa real, para que el camino sin arena no reciba un heap vacío y ordenado.
+// El argumento `conArena` elige la arena por defecto de Nodo<int> (1) o `new` global (0); los nodos
+// intrusivos salen siempre de la arena de su tipo.
+template <typename Politica = PoliticaPorDefecto>
+struct ListaDePrueba {
+    ListaDoble<int, Politica> lista;
+    std::vector<std::unique_ptr<char[]>> relleno;
+
+    ListaDePrueba(int n, bool conArena) : lista(crearLista(conArena)) {
+        std::mt19937 generador(42);
+        relleno.reserve(n);
+        for (int i = 0; i < n; i++) {
+            lista.agregar(static_cast<int>(generador()));
+            relleno.emplace_back(new char[16 + generador() % 48]);
+        }
+    }
+
+    static ListaDoble<int, Politica> crearLista(bool conArena) {
+        if constexpr (Politica::intrusivo) {
+            return ListaDoble<int, Politica>();
+        } else {
+            return ListaDoble<int, Politica>(conArena ? BloqueEnLinea<Nodo<int, Politica>>::arenaPorDefecto() : nullptr);
+        }
+    }
+
+    // Rompe los ciclos siguiente/anterior nodo por nodo para liberar la lista sin recursión
+    ~ListaDePrueba() {
+        EnlaceNodo<int, Politica> actual = lista.obtenerHead();
+        while (actual != nullptr) {
+            EnlaceNodo<int, Politica> siguiente = actual->siguiente;
+            actual->siguiente = nullptr;
+            actual->anterior = nullptr;
+            actual = siguiente;
+        }
+    }
+
+    // Reescribe los valores, en el orden actual de la lista, según el tipo de entrada
+    void preparar(Entrada entrada, std::mt19937& generador) {
+        int posicion = 0;
+        for (VistaNodo<int, Politica> actual = lista.obtenerHead(); actual != nullptr; actual = actual->siguiente) {
+            switch (entrada) {
+            case Entrada::Aleatoria:
+                actual->data = static_cast<int>(generador());
+                break;
+            case Entrada::Ordenada:
+                actual->data = posicion;
+                break;
+            case Entrada::Inversa:
+                actual->data = -posicion;
+                break;
+            case Entrada::Repetida:
+                actual->data = static_cast<int>(generador() % 16);
+                break;
+            }
+            posicion++;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include "ListaDePrueba.h"
+#include "ListaDesenrollada.h"
+
+// Recorrido completo de la lista sumando sus valores
+static void BM_RecorridoLista(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    ListaDePrueba<> prueba(n, state.range(1) != 0);
+    for (auto _ : state) {
+        long long suma = 0;
+        for (MPointerVista<Nodo<int>> actual = prueba.lista.obtenerHead(); actual != nullptr; actual = actual->siguiente) {
+            suma += actual->data;
+        }
+        benchmark::DoNotOptimize(suma);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_RecorridoLista)->ArgNames({"nodos", "arena"})
+    ->ArgsProduct({benchmark::CreateRange(100, 10000000, 10), {0, 1}})->Unit(benchmark::kMillisecond);
+
+// quickSort sobre valores aleatorios; los valores se vuelven a mezclar fuera de la medición
+static void BM_QuickSortLista(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    ListaDePrueba<> prueba(n, state.range(1) != 0);
+    std::mt19937 generador(7);
+    for (auto _ : state) {
+        state.PauseTiming();
+        prueba.preparar(Entrada::Aleatoria, generador);
+        state.ResumeTiming();
+        quickSort(prueba.lista.obtenerHead(), prueba.lista.obtenerTail());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_QuickSortLista)->ArgNames({"nodos", "arena"})
+    ->ArgsProduct({{1000, 1000000, 10000000}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// Memoria por nodo y recorrido con contador externo (PoliticaPorDefecto) o intrusivo (PoliticaIntrusiva).
+// `bytes_por_nodo` sale de MPointerGC::stats(): lo que ocupa cada nodo con sus metadatos.
+template <typename Politica>
+static void BM_RecorridoNodos(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    EstadisticasGC antes = MPointerGC::getInstance().stats();
+    ListaDePrueba<Politica> prueba(n, true);
+    EstadisticasGC despues = MPointerGC::getInstance().stats();
+    for (auto _ : state) {
+        long long suma = 0;
+        for (VistaNodo<int, Politica> actual = prueba.lista.obtenerHead(); actual != nullptr; actual = actual->siguiente) {
+            suma += actual->data;
+        }
+        benchmark::DoNotOptimize(suma);
+    }
+    state.counters["bytes_por_nodo"] = static_cast<double>(despues.bytesVivos - antes.bytesVivos) / n;
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetBytesProcessed(state.iterations() * n * static_cast<int64_t>(sizeof(int)));
+}
+BENCHMARK_TEMPLATE(BM_RecorridoNodos, PoliticaPorDefecto)->ArgName("nodos")
+    ->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RecorridoNodos, PoliticaIntrusiva)->ArgName("nodos")
+    ->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+// Recorrido de una ListaDesenrollada<int> (64 enteros por nodo), para comparar con BM_RecorridoNodos.
+// Los bytes procesados cuentan solo los enteros leídos.
+static void BM_RecorridoDesenrollada(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    EstadisticasGC antes = MPointerGC::getInstance().stats();
+    ListaDesenrollada<int> lista;
+    std::mt19937 generador(42);
+    for (int i = 0; i < n; i++) {
+        lista.agregar(static_cast<int>(generador()));
+    }
+    EstadisticasGC despues = MPointerGC::getInstance().stats();
+    for (auto _ : state) {
+        long long suma = 0;
+        for (int valor : lista) {
+            suma += valor;
+        }
+        benchmark::DoNotOptimize(suma);
+    }
+    state.counters["bytes_por_nodo"] = static_cast<double>(despues.bytesVivos - antes.bytesVivos) / n;
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetBytesProcessed(state.iterations() * n * static_cast<int64_t>(sizeof(int)));
+}
+BENCHMARK(BM_RecorridoDesenrollada)->ArgName("nodos")->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+// El mismo recorrido que BM_RecorridoNodos, con range-for sobre los iteradores de ListaDoble:
+// debe costar lo mismo, porque el iterador es un puntero crudo al nodo.
+template <typename Politica>
+static void BM_RecorridoIteradores(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    ListaDePrueba<Politica> prueba(n, true);
+    for (auto _ : state) {
+        long long suma = 0;
+        for (int valor : prueba.lista) {
+            suma += valor;
+        }
+        benchmark::DoNotOptimize(suma);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetBytesProcessed(state.iterations() * n * static_cast<int64_t>(sizeof(int)));
+}
+BENCHMARK_TEMPLATE(BM_RecorridoIteradores, PoliticaPorDefecto)->ArgName("nodos")
+    ->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RecorridoIteradores, PoliticaIntrusiva)->ArgName("nodos")
+    ->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
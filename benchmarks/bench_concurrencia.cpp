@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "ListaConcurrente.h"
+
+// Traspaso de valores de N productores (los hilos del benchmark) a un consumidor en un hilo aparte.
+// El hilo 0 crea la lista y el consumidor antes del bucle y los detiene después: el inicio y el fin
+// del bucle esperan a todos los hilos, así que los demás nunca ven la lista a medio crear.
+// Los productores se miden; el consumidor compite por el núcleo como lo haría en producción.
+
+static ListaConcurrente<long>* listaCompartida = nullptr;
+static std::thread consumidor;
+static std::atomic<bool> detenerConsumidor{false};
+
+static void consumir() {
+    long valor = 0;
+    while (!detenerConsumidor.load(std::memory_order_relaxed)) {
+        if (!listaCompartida->extraer(valor)) {
+            std::this_thread::yield();
+        }
+    }
+    while (listaCompartida->extraer(valor)) {
+    }
+}
+
+// Productores con ListaConcurrente::agregar: un `exchange` por valor
+static void BM_ListaConcurrenteAgregar(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        listaCompartida = new ListaConcurrente<long>();
+        detenerConsumidor.store(false);
+        consumidor = std::thread(consumir);
+    }
+    long valor = 0;
+    for (auto _ : state) {
+        listaCompartida->agregar(valor++);
+    }
+    if (state.thread_index() == 0) {
+        detenerConsumidor.store(true);
+        consumidor.join();
+        delete listaCompartida;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ListaConcurrenteAgregar)->ThreadRange(1, 32)->UseRealTime();
+
+// Productores con ListaConcurrente::agregarRango, de a 16 valores: un `exchange` por lote
+static void BM_ListaConcurrenteLotes(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        listaCompartida = new ListaConcurrente<long>();
+        detenerConsumidor.store(false);
+        consumidor = std::thread(consumir);
+    }
+    long lote[16] = {};
+    for (auto _ : state) {
+        listaCompartida->agregarRango(lote, lote + 16);
+    }
+    if (state.thread_index() == 0) {
+        detenerConsumidor.store(true);
+        consumidor.join();
+        delete listaCompartida;
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(BM_ListaConcurrenteLotes)->ThreadRange(1, 32)->UseRealTime();
+
+// Lo que reemplaza: una ListaDoble protegida por un mutex, de la que el consumidor saca el primer valor
+static ListaDoble<long>* listaConMutex = nullptr;
+static std::mutex mutexLista;
+
+static void consumirConMutex() {
+    for (;;) {
+        bool extraido = false;
+        {
+            std::lock_guard<std::mutex> candado(mutexLista);
+            if (listaConMutex->obtenerHead() != nullptr) {
+                listaConMutex->eliminarEn(0);
+                extraido = true;
+            } else if (detenerConsumidor.load(std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        if (!extraido) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+static void BM_ListaDobleConMutex(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        listaConMutex = new ListaDoble<long>();
+        detenerConsumidor.store(false);
+        consumidor = std::thread(consumirConMutex);
+    }
+    long valor = 0;
+    for (auto _ : state) {
+        std::lock_guard<std::mutex> candado(mutexLista);
+        listaConMutex->agregar(valor++);
+    }
+    if (state.thread_index() == 0) {
+        detenerConsumidor.store(true);
+        consumidor.join();
+        delete listaConMutex;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ListaDobleConMutex)->ThreadRange(1, 32)->UseRealTime();
@@ -0,0 +1,188 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <vector>
+#include "ListaDoble.h"
+
+// Registro y eliminación en el GC desde N hilos, cada uno sobre su propio fragmento
+static void BM_RegistroConcurrente(benchmark::State& state) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    BloqueControl* bloque = BloqueEnLinea<int>::crear(0);
+    for (auto _ : state) {
+        MPointerGC::Handle id = gc.registerPointer(bloque);
+        gc.deregisterPointer(id);
+    }
+    bloque->destruir();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RegistroConcurrente)->ThreadRange(1, 64)->UseRealTime();
+
+// Registro y eliminación con un conjunto de N objetos ya registrados (1e2 a 1e7)
+static void BM_RegistroConVivos(benchmark::State& state) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    BloqueControl* bloque = BloqueEnLinea<int>::crear(0);
+    std::vector<MPointerGC::Handle> vivos(static_cast<std::size_t>(state.range(0)));
+    for (MPointerGC::Handle& id : vivos) {
+        id = gc.registerPointer(bloque);
+    }
+    for (auto _ : state) {
+        MPointerGC::Handle id = gc.registerPointer(bloque);
+        gc.deregisterPointer(id);
+    }
+    for (MPointerGC::Handle id : vivos) {
+        gc.deregisterPointer(id);
+    }
+    bloque->destruir();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RegistroConVivos)->RangeMultiplier(10)->Range(100, 10000000);
+
+// Creación y destrucción de MPointers desde N hilos
+static void BM_NewConcurrente(benchmark::State& state) {
+    for (auto _ : state) {
+        MPointer<int> ptr = MPointer<int>::New(1);
+        benchmark::DoNotOptimize(&ptr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NewConcurrente)->ThreadRange(1, 64)->UseRealTime();
+
+// Lo mismo en el modo generacional, donde cada hilo asigna en su propia guardería
+static void BM_NewConcurrenteGeneracional(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        MPointerGC::getInstance().setGenerationalMode(true);
+    }
+    for (auto _ : state) {
+        MPointer<int> ptr = MPointer<int>::New(1);
+        benchmark::DoNotOptimize(&ptr);
+    }
+    if (state.thread_index() == 0) {
+        MPointerGC::getInstance().setGenerationalMode(false);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NewConcurrenteGeneracional)->ThreadRange(1, 64)->UseRealTime();
+
+// Recolección menor con N jóvenes vivos entre cien mil temporales: la pausa depende de los que
+// sobreviven (y se promueven), no del tamaño del registro
+static void BM_RecoleccionMenor(benchmark::State& state) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    const int sobrevivientes = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        gc.setGenerationalMode(true);
+        std::vector<MPointer<int>> vivos;
+        for (int i = 0; i < 100000; i++) {
+            MPointer<int> temporal = MPointer<int>::New(i);
+            if (i % (100000 / sobrevivientes) == 0) {
+                vivos.push_back(std::move(temporal));
+            }
+        }
+        gc.setGenerationalMode(false);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(gc.runMinorGC());
+        state.PauseTiming();
+        vivos.clear();
+        state.ResumeTiming();
+    }
+    state.counters["supervivencia"] = gc.stats().supervivencia;
+}
+BENCHMARK(BM_RecoleccionMenor)->Arg(10)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// Creación y destrucción de MPointers con una muestra de la pila cada N registros (0: sin muestreo).
+// El costo del perfil sin muestreo se mide comparando BM_NewConcurrente con un build con MPOINTERGC_SIN_PERFIL.
+static void BM_NewMuestreado(benchmark::State& state) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.setAllocationSampling(static_cast<std::uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        MPointer<int> ptr = MPointer<int>::New(1);
+        benchmark::DoNotOptimize(&ptr);
+    }
+    gc.setAllocationSampling(0);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NewMuestreado)->ArgName("cadaN")->Arg(0)->Arg(64)->Arg(4096);
+
+// Consulta del perfil del heap con N objetos vivos: recorre el registro entero
+static void BM_PerfilHeap(benchmark::State& state) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    BloqueControl* bloque = BloqueEnLinea<int>::crear(0);
+    std::vector<MPointerGC::Handle> vivos(static_cast<std::size_t>(state.range(0)));
+    for (MPointerGC::Handle& id : vivos) {
+        id = gc.registerPointer(bloque);
+    }
+    for (auto _ : state) {
+        PerfilHeap perfil = gc.heapProfile();
+        benchmark::DoNotOptimize(perfil.tipos.data());
+    }
+    for (MPointerGC::Handle id : vivos) {
+        gc.deregisterPointer(id);
+    }
+    bloque->destruir();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerfilHeap)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Copias de un mismo MPointer compartido entre N hilos (política con contador atómico)
+static MPointer<int, PoliticaCompartida> compartido(nullptr);
+
+static void BM_CopiaCompartida(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        compartido = MPointer<int, PoliticaCompartida>::New(1);
+    }
+    for (auto _ : state) {
+        MPointer<int, PoliticaCompartida> copia = compartido;
+        benchmark::DoNotOptimize(&copia);
+    }
+    if (state.thread_index() == 0) {
+        compartido = nullptr;
+    }
+}
+BENCHMARK(BM_CopiaCompartida)->ThreadRange(1, 64)->UseRealTime();
+
+// Deja `listas` listas destruidas de `nodos` nodos cada una, como basura cíclica para el GC
+static void generarBasura(int listas, int nodos) {
+    for (int l = 0; l < listas; l++) {
+        ListaDoble<int> lista;
+        for (int i = 0; i < nodos; i++) {
+            lista.agregar(i);
+        }
+    }
+}
+
+// Pausa de una recolección completa sobre un registro de N nodos
+static void BM_PausaRunGC(benchmark::State& state) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    const int n = static_cast<int>(state.range(0));
+    gc.resetPauseStats();
+    for (auto _ : state) {
+        state.PauseTiming();
+        generarBasura(n / 100, 100);
+        state.ResumeTiming();
+        gc.runGC();
+    }
+    EstadisticasPausas pausas = gc.pauseStats();
+    state.counters["p50_us"] = pausas.p50.count() / 1000.0;
+    state.counters["p99_us"] = pausas.p99.count() / 1000.0;
+}
+BENCHMARK(BM_PausaRunGC)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Misma basura recolectada en tramos de 200 us: se reportan los percentiles de cada tramo
+static void BM_PausaTramos(benchmark::State& state) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    const int n = static_cast<int>(state.range(0));
+    gc.resetPauseStats();
+    for (auto _ : state) {
+        state.PauseTiming();
+        generarBasura(n / 100, 100);
+        std::size_t objetivo = gc.size() - static_cast<std::size_t>(n / 100 * 100);
+        state.ResumeTiming();
+        while (gc.size() > objetivo) {
+            gc.runGCSlice(std::chrono::microseconds(200));
+        }
+    }
+    EstadisticasPausas pausas = gc.pauseStats();
+    state.counters["tramos"] = static_cast<double>(pausas.cantidad) / state.iterations();
+    state.counters["p50_us"] = pausas.p50.count() / 1000.0;
+    state.counters["p99_us"] = pausas.p99.count() / 1000.0;
+}
+BENCHMARK(BM_PausaTramos)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMillisecond);
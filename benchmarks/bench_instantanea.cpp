@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "InstantaneaLista.h"
+
+// Las instantáneas se escriben en el directorio actual. Las lecturas miden el archivo ya en la caché
+// del sistema, que es el caso de un reinicio del servicio sin reiniciar la máquina.
+static const std::string RUTA_INSTANTANEA = "bench_instantanea.bin";
+
+// Rompe los ciclos siguiente/anterior nodo por nodo para liberar la lista sin recursión
+template <typename T>
+static void vaciarLista(const MPointer<Nodo<T>>& head) {
+    MPointer<Nodo<T>> actual = head;
+    while (actual != nullptr) {
+        MPointer<Nodo<T>> siguiente = actual->siguiente;
+        actual->siguiente = nullptr;
+        actual->anterior = nullptr;
+        actual = siguiente;
+    }
+}
+
+// Tamaños de 1e6 a `maximo`. Una ListaDoble<int> de 1e8 nodos ocupa más de 7 GB, así que las mediciones
+// que la construyen llegan a 1e7; las que trabajan solo con el archivo llegan a 1e8 (400 MB).
+static void tamanosHasta(benchmark::internal::Benchmark* benchmark, int maximo) {
+    benchmark->ArgName("valores");
+    for (int n = 1000000; n <= maximo; n *= 10) {
+        benchmark->Arg(n);
+    }
+}
+
+// Guardar una ListaDoble<int>: recorrido de los nodos y escritura por búfer
+static void BM_GuardarInstantaneaLista(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    std::vector<int> valores(n);
+    std::iota(valores.begin(), valores.end(), 0);
+    ListaDoble<int> lista(valores.begin(), valores.end());
+    for (auto _ : state) {
+        guardarInstantanea(lista, RUTA_INSTANTANEA);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetBytesProcessed(state.iterations() * n * static_cast<int64_t>(sizeof(int)));
+    vaciarLista(lista.obtenerHead());
+    std::remove(RUTA_INSTANTANEA.c_str());
+}
+BENCHMARK(BM_GuardarInstantaneaLista)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000000); })
+    ->Unit(benchmark::kMillisecond);
+
+// Guardar un arreglo contiguo: el límite de la escritura, con una sola copia de los datos
+static void BM_GuardarInstantaneaArreglo(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    std::vector<int> valores(n);
+    std::iota(valores.begin(), valores.end(), 0);
+    for (auto _ : state) {
+        guardarInstantanea(valores.data(), valores.data() + n, RUTA_INSTANTANEA);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetBytesProcessed(state.iterations() * n * static_cast<int64_t>(sizeof(int)));
+    std::remove(RUTA_INSTANTANEA.c_str());
+}
+BENCHMARK(BM_GuardarInstantaneaArreglo)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 100000000); })
+    ->Unit(benchmark::kMillisecond);
+
+// Mapear una instantánea y sumar sus valores en el lugar, sin crear nodos
+static void BM_MapearInstantanea(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    {
+        std::vector<int> valores(n);
+        std::iota(valores.begin(), valores.end(), 0);
+        guardarInstantanea(valores.data(), valores.data() + n, RUTA_INSTANTANEA);
+    }
+    for (auto _ : state) {
+        InstantaneaMapeada<int> instantanea(RUTA_INSTANTANEA);
+        long long suma = std::accumulate(instantanea.begin(), instantanea.end(), 0LL);
+        benchmark::DoNotOptimize(suma);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetBytesProcessed(state.iterations() * n * static_cast<int64_t>(sizeof(int)));
+    std::remove(RUTA_INSTANTANEA.c_str());
+}
+BENCHMARK(BM_MapearInstantanea)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 100000000); })
+    ->Unit(benchmark::kMillisecond);
+
+// Cargar una instantánea plana en una ListaDoble<int> (mmap y agregarRango)
+static void BM_CargarInstantaneaLista(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    {
+        std::vector<int> valores(n);
+        std::iota(valores.begin(), valores.end(), 0);
+        guardarInstantanea(valores.data(), valores.data() + n, RUTA_INSTANTANEA);
+    }
+    for (auto _ : state) {
+        ListaDoble<int> lista;
+        cargarInstantanea(RUTA_INSTANTANEA, lista);
+        state.PauseTiming();
+        vaciarLista(lista.obtenerHead());
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    std::remove(RUTA_INSTANTANEA.c_str());
+}
+BENCHMARK(BM_CargarInstantaneaLista)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000000); })
+    ->Unit(benchmark::kMillisecond);
+
+// Guardar y cargar cadenas: el formato de registros, de una sola pasada
+static void BM_InstantaneaCadenas(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    ListaDoble<std::string> lista;
+    for (int i = 0; i < n; i++) {
+        lista.agregar("valor " + std::to_string(i));
+    }
+    for (auto _ : state) {
+        guardarInstantanea(lista, RUTA_INSTANTANEA);
+        ListaDoble<std::string> cargada;
+        cargarInstantanea(RUTA_INSTANTANEA, cargada);
+        state.PauseTiming();
+        vaciarLista(cargada.obtenerHead());
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    vaciarLista(lista.obtenerHead());
+    std::remove(RUTA_INSTANTANEA.c_str());
+}
+BENCHMARK(BM_InstantaneaCadenas)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000000); })
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,228 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <numeric>
+#include <vector>
+#include "ListaDoble.h"
+
+// Contador global de reservas, para reportar cuántas llamadas a `new` hace cada camino
+static std::atomic<std::size_t> reservas{0};
+
+void* operator new(std::size_t bytes) {
+    reservas.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(bytes == 0 ? 1 : bytes)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// Rompe los ciclos siguiente/anterior nodo por nodo para liberar la lista sin recursión
+template <typename T>
+void desarmar(MPointer<Nodo<T>> actual) {
+    while (actual != nullptr) {
+        MPointer<Nodo<T>> siguiente = actual->siguiente;
+        actual->siguiente = nullptr;
+        actual->anterior = nullptr;
+        actual = siguiente;
+    }
+}
+
+// Creación y destrucción de un MPointer (reserva, registro en el GC, eliminación y liberación)
+static void BM_MPointerCrear(benchmark::State& state) {
+    for (auto _ : state) {
+        MPointer<int> ptr = MPointer<int>::New(1);
+        benchmark::DoNotOptimize(&ptr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MPointerCrear);
+
+// Lo mismo en el modo generacional: el objeto nace y muere en la guardería del hilo, sin registro
+static void BM_MPointerCrearGeneracional(benchmark::State& state) {
+    MPointerGC::getInstance().setGenerationalMode(true);
+    for (auto _ : state) {
+        MPointer<int> ptr = MPointer<int>::New(1);
+        benchmark::DoNotOptimize(&ptr);
+    }
+    MPointerGC::getInstance().setGenerationalMode(false);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MPointerCrearGeneracional);
+
+// Copia y destrucción de la copia: solo el contador de referencias
+static void BM_MPointerCopiar(benchmark::State& state) {
+    MPointer<int> original = MPointer<int>::New(1);
+    for (auto _ : state) {
+        MPointer<int> copia = original;
+        benchmark::DoNotOptimize(&copia);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MPointerCopiar);
+
+// Movimiento de ida y vuelta: no toca el contador
+static void BM_MPointerMover(benchmark::State& state) {
+    MPointer<int> original = MPointer<int>::New(1);
+    for (auto _ : state) {
+        MPointer<int> movido = std::move(original);
+        original = std::move(movido);
+        benchmark::DoNotOptimize(&original);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MPointerMover);
+
+// Construcción de la lista con ListaDoble::agregar (objeto y contador en un mismo bloque)
+static void BM_ListaAgregarBloqueUnico(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    std::size_t reservasMedidas = 0;
+    for (auto _ : state) {
+        std::size_t antes = reservas.load(std::memory_order_relaxed);
+        ListaDoble<int> lista;
+        for (int i = 0; i < n; i++) {
+            lista.agregar(i);
+        }
+        reservasMedidas += reservas.load(std::memory_order_relaxed) - antes;
+        state.PauseTiming();
+        desarmar(lista.obtenerHead());
+        state.ResumeTiming();
+    }
+    state.counters["reservas_por_nodo"] = static_cast<double>(reservasMedidas) / (static_cast<double>(n) * state.iterations());
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_ListaAgregarBloqueUnico)->RangeMultiplier(10)->Range(100, 10000000)->Unit(benchmark::kMillisecond);
+
+// Misma construcción desde un búfer con ListaDoble::agregarRango (reserva en lote y un solo registro)
+static void BM_ListaAgregarRango(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    std::vector<int> valores(n);
+    std::iota(valores.begin(), valores.end(), 0);
+    std::size_t reservasMedidas = 0;
+    for (auto _ : state) {
+        std::size_t antes = reservas.load(std::memory_order_relaxed);
+        ListaDoble<int> lista(valores.begin(), valores.end());
+        reservasMedidas += reservas.load(std::memory_order_relaxed) - antes;
+        state.PauseTiming();
+        desarmar(lista.obtenerHead());
+        state.ResumeTiming();
+    }
+    state.counters["reservas_por_nodo"] = static_cast<double>(reservasMedidas) / (static_cast<double>(n) * state.iterations());
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_ListaAgregarRango)->RangeMultiplier(10)->Range(100, 10000000)->Unit(benchmark::kMillisecond);
+
+// Acceso a posiciones al azar: con el índice (at) o recorriendo enlaces desde head (std::next)
+static void BM_ListaAccesoPosicion(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const bool conIndice = state.range(1) != 0;
+    std::vector<int> valores(n);
+    std::iota(valores.begin(), valores.end(), 0);
+    ListaDoble<int> lista(valores.begin(), valores.end());
+    lista.at(0);  // Construye el índice fuera de la medición.
+    std::uint32_t semilla = 12345;
+    for (auto _ : state) {
+        semilla = semilla * 1664525u + 1013904223u;
+        std::size_t posicion = semilla % static_cast<std::uint32_t>(n);
+        int valor = conIndice ? lista.at(posicion) : *std::next(lista.begin(), static_cast<std::ptrdiff_t>(posicion));
+        benchmark::DoNotOptimize(valor);
+    }
+    state.SetItemsProcessed(state.iterations());
+    desarmar(lista.obtenerHead());
+}
+BENCHMARK(BM_ListaAccesoPosicion)->ArgNames({"nodos", "indice"})->ArgsProduct({{1000, 100000, 1000000}, {0, 1}});
+
+// Inserción y eliminación en posiciones al azar con el índice
+static void BM_ListaInsertarEliminar(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    std::vector<int> valores(n);
+    std::iota(valores.begin(), valores.end(), 0);
+    ListaDoble<int> lista(valores.begin(), valores.end());
+    lista.at(0);
+    std::uint32_t semilla = 12345;
+    for (auto _ : state) {
+        semilla = semilla * 1664525u + 1013904223u;
+        lista.insertarEn(semilla % static_cast<std::uint32_t>(n), 0);
+        semilla = semilla * 1664525u + 1013904223u;
+        lista.eliminarEn(semilla % static_cast<std::uint32_t>(n));
+    }
+    state.SetItemsProcessed(state.iterations());
+    desarmar(lista.obtenerHead());
+}
+BENCHMARK(BM_ListaInsertarEliminar)->ArgName("nodos")->Arg(1000)->Arg(100000)->Arg(1000000);
+
+// Misma construcción adoptando nodos creados con `new`, que reservan objeto y bloque por separado
+static void BM_ListaAgregarReservaSeparada(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    std::size_t reservasMedidas = 0;
+    for (auto _ : state) {
+        std::size_t antes = reservas.load(std::memory_order_relaxed);
+        MPointer<Nodo<int>> head(nullptr);
+        MPointer<Nodo<int>> tail(nullptr);
+        for (int i = 0; i < n; i++) {
+            MPointer<Nodo<int>> nuevoNodo(new Nodo<int>(i));
+            if (head == nullptr) {
+                head = nuevoNodo;
+                tail = nuevoNodo;
+            } else {
+                tail->siguiente = nuevoNodo;
+                nuevoNodo->anterior = tail;
+                tail = nuevoNodo;
+            }
+        }
+        reservasMedidas += reservas.load(std::memory_order_relaxed) - antes;
+        state.PauseTiming();
+        tail = nullptr;
+        desarmar(head);
+        head = nullptr;
+        state.ResumeTiming();
+    }
+    state.counters["reservas_por_nodo"] = static_cast<double>(reservasMedidas) / (static_cast<double>(n) * state.iterations());
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_ListaAgregarReservaSeparada)->RangeMultiplier(10)->Range(100, 10000000)->Unit(benchmark::kMillisecond);
+
+// Liberación de una lista que nadie más referencia: con enlaces fuertes los ciclos esperan al GC
+// (se mide runGC), con PoliticaAnteriorDebil los nodos se liberan al destruir la lista
+static void BM_ListaLiberar(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const bool anteriorDebil = state.range(1) != 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        MPointerGC::getInstance().runGC();
+        ListaDoble<int>* fuerte = nullptr;
+        ListaDoble<int, PoliticaAnteriorDebil>* debil = nullptr;
+        if (anteriorDebil) {
+            debil = new ListaDoble<int, PoliticaAnteriorDebil>();
+            for (int i = 0; i < n; i++) {
+                debil->agregar(i);
+            }
+        } else {
+            fuerte = new ListaDoble<int>();
+            for (int i = 0; i < n; i++) {
+                fuerte->agregar(i);
+            }
+        }
+        state.ResumeTiming();
+        if (anteriorDebil) {
+            delete debil;
+        } else {
+            delete fuerte;
+            MPointerGC::getInstance().runGC();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_ListaLiberar)->ArgNames({"nodos", "anteriorDebil"})->ArgsProduct({{10000, 1000000}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,140 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include "ListaDePrueba.h"
+#include "OrdenamientoExterno.h"
+
+// Cada algoritmo se mide sobre las cuatro entradas de ListaDePrueba (argumento "entrada": 0 aleatoria,
+// 1 ordenada, 2 inversa, 3 repetida). Los valores se reescriben fuera de la medición en cada iteración.
+template <typename Ordenar>
+static void medirOrdenamiento(benchmark::State& state, Ordenar ordenar) {
+    const int n = static_cast<int>(state.range(0));
+    const Entrada entrada = static_cast<Entrada>(state.range(1));
+    ListaDePrueba<> prueba(n, true);
+    std::mt19937 generador(7);
+    for (auto _ : state) {
+        state.PauseTiming();
+        prueba.preparar(entrada, generador);
+        state.ResumeTiming();
+        ordenar(prueba.lista);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Tamaños de 1e2 a `maximo` para cada entrada
+static void tamanosHasta(benchmark::internal::Benchmark* benchmark, int maximo) {
+    benchmark->ArgNames({"nodos", "entrada"});
+    for (int entrada = 0; entrada < 4; entrada++) {
+        for (int n = 100; n <= maximo; n *= 10) {
+            benchmark->Args({n, entrada});
+        }
+    }
+}
+
+// quickSort es O(n log n) solo con entrada aleatoria: con el último nodo como pivote, las entradas
+// ordenadas, inversas y repetidas lo vuelven cuadrático, así que se cortan en 1e4.
+static void tamanosQuickSort(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"nodos", "entrada"});
+    for (int entrada = 0; entrada < 4; entrada++) {
+        int maximo = entrada == static_cast<int>(Entrada::Aleatoria) ? 10000000 : 10000;
+        for (int n = 100; n <= maximo; n *= 10) {
+            benchmark->Args({n, entrada});
+        }
+    }
+}
+
+static void BM_QuickSort(benchmark::State& state) {
+    medirOrdenamiento(state, [](ListaDoble<int>& lista) { quickSort(lista.obtenerHead(), lista.obtenerTail()); });
+}
+BENCHMARK(BM_QuickSort)->Apply(tamanosQuickSort)->Unit(benchmark::kMillisecond);
+
+static void BM_MergeSort(benchmark::State& state) {
+    medirOrdenamiento(state, [](ListaDoble<int>& lista) { lista.ordenarMerge(); });
+}
+BENCHMARK(BM_MergeSort)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000000); })
+    ->Unit(benchmark::kMillisecond);
+
+// RadixSort (ListaDoble::ordenar con int): lineal en cualquier entrada, se compara con BM_QuickSort/entrada:0
+static void BM_RadixSort(benchmark::State& state) {
+    medirOrdenamiento(state, [](ListaDoble<int>& lista) { lista.ordenar(); });
+}
+BENCHMARK(BM_RadixSort)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000000); })
+    ->Unit(benchmark::kMillisecond);
+
+// QuickSort sobre las claves copiadas a un arreglo, con partición AVX2 (si la hay) y escalar sin saltos.
+// Se comparan con BM_QuickSort/entrada:0 y BM_RadixSort; en las otras entradas no hay caso cuadrático.
+static void BM_QuickSortContiguo(benchmark::State& state) {
+    medirOrdenamiento(state, [](ListaDoble<int>& lista) { quickSortContiguo(lista.obtenerHead(), lista.obtenerTail()); });
+}
+BENCHMARK(BM_QuickSortContiguo)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000000); })
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_QuickSortContiguoEscalar(benchmark::State& state) {
+    medirOrdenamiento(state, [](ListaDoble<int>& lista) {
+        quickSortContiguo(lista.obtenerHead(), lista.obtenerTail(), NucleoParticion::Escalar);
+    });
+}
+BENCHMARK(BM_QuickSortContiguoEscalar)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000000); })
+    ->Unit(benchmark::kMillisecond);
+
+// Los algoritmos cuadráticos se miden hasta 1e4
+static void BM_BubbleSort(benchmark::State& state) {
+    medirOrdenamiento(state, [](ListaDoble<int>& lista) { bubbleSort(lista.obtenerHead()); });
+}
+BENCHMARK(BM_BubbleSort)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000); })
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_InsertionSort(benchmark::State& state) {
+    medirOrdenamiento(state, [](ListaDoble<int>& lista) { insertionSort(lista.obtenerHead()); });
+}
+BENCHMARK(BM_InsertionSort)->Apply([](benchmark::internal::Benchmark* b) { tamanosHasta(b, 10000); })
+    ->Unit(benchmark::kMillisecond);
+
+// ordenarParalelo sobre valores aleatorios con un pool de `hilos` hilos; con 1 hilo es la base
+// de la aceleración. Se compara con BM_QuickSort/entrada:0 para los mismos tamaños.
+static void BM_OrdenarParalelo(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    PoolTareas pool(static_cast<unsigned>(state.range(1)));
+    ListaDePrueba<> prueba(n, true);
+    std::mt19937 generador(7);
+    for (auto _ : state) {
+        state.PauseTiming();
+        prueba.preparar(Entrada::Aleatoria, generador);
+        state.ResumeTiming();
+        prueba.lista.ordenarParalelo(pool);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_OrdenarParalelo)->ArgNames({"nodos", "hilos"})
+    ->ArgsProduct({{1000000, 10000000}, {1, 2, 4, 8, 16}})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Ordenamiento externo de una instantánea de enteros aleatorios hacia otra, con un presupuesto de
+// `memoria_mb` MB: con 1e8 valores (400 MB) y 64 MB se vuelcan 6 tramos. El contador `MB_por_s` es el
+// que informa ResultadoOrdenExterno (datos ordenados por segundo, con la lectura y la escritura).
+static void BM_OrdenamientoExterno(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const std::string entrada = "bench_orden_entrada.bin";
+    const std::string salida = "bench_orden_salida.bin";
+    {
+        std::vector<int> valores(n);
+        std::mt19937 generador(7);
+        for (int& valor : valores) {
+            valor = static_cast<int>(generador());
+        }
+        guardarInstantanea(valores.data(), valores.data() + n, entrada);
+    }
+    OpcionesOrdenExterno opciones;
+    opciones.bytesMemoria = static_cast<std::size_t>(state.range(1)) << 20;
+    double megabytes = 0;
+    for (auto _ : state) {
+        ResultadoOrdenExterno resultado = ordenarInstantanea<int>(entrada, salida, opciones);
+        megabytes += resultado.megabytesPorSegundo();
+        state.counters["tramos"] = static_cast<double>(resultado.tramos);
+    }
+    state.counters["MB_por_s"] = megabytes / state.iterations();
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetBytesProcessed(state.iterations() * n * static_cast<int64_t>(sizeof(int)));
+    std::remove(entrada.c_str());
+    std::remove(salida.c_str());
+}
+BENCHMARK(BM_OrdenamientoExterno)->ArgNames({"valores", "memoria_mb"})
+    ->ArgsProduct({{1000000, 10000000, 100000000}, {64, 1024}})->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -2,6 +2,9 @@
 #include <iostream>
 
 int main() {
+    // El GC no escribe nada por defecto; aquí se pide un resumen de cada recolección.
+    MPointerGC::getInstance().setLogLevel(NivelRegistroGC::Ciclos);
+
     {
         // Se crea un nuevo puntero MPointer que gestionará un puntero a un entero.
         // La función MPointer::New() inicializa un nuevo objeto MPointer y lo registra
@@ -1,45 +1,230 @@
 #ifndef SORTING_H
 #define SORTING_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "Nodo.h"
+#include "PoolTareas.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#endif
 
 // Implementación de QuickSort para lista doblemente enlazada
 // Qué sucede: Divide la lista en dos sublistas en torno a un pivote y las ordena recursivamente.
 // Por qué sucede: Utiliza el algoritmo QuickSort para ordenar la lista de manera eficiente.
 // Qué deberíamos esperar: La lista se ordena en su totalidad.
-template <typename T>
-MPointer<Nodo<T>> particion(MPointer<Nodo<T>> low, MPointer<Nodo<T>> high) {
+template <typename T, typename P>
+VistaNodo<T, P> particion(VistaNodo<T, P> low, VistaNodo<T, P> high) {
     T pivote = high->data;  // Selecciona el último elemento como pivote.
-    MPointer<Nodo<T>> i = low->anterior;  // `i` es el índice de elementos más pequeños que el pivote.
+    VistaNodo<T, P> i = low->anterior;  // `i` es el índice de elementos más pequeños que el pivote.
 
-    for (MPointer<Nodo<T>> j = low; j != high; j = j->siguiente) {
+    for (VistaNodo<T, P> j = low; j != high; j = j->siguiente) {
         if (j->data <= pivote) {  // Si el elemento es menor o igual al pivote.
-            i = (i == nullptr) ? low : i->siguiente;  // Mueve `i` un paso adelante.
+            i = (i == nullptr) ? low : VistaNodo<T, P>(i->siguiente);  // Mueve `i` un paso adelante.
             std::swap(i->data, j->data);  // Intercambia los valores de `i` y `j`.
         }
     }
-    i = (i == nullptr) ? low : i->siguiente;  // Mueve `i` un paso más.
+    i = (i == nullptr) ? low : VistaNodo<T, P>(i->siguiente);  // Mueve `i` un paso más.
     std::swap(i->data, high->data);  // Coloca el pivote en su lugar.
     return i;  // Devuelve la posición del pivote.
 }
 
-template <typename T>
-void quickSort(MPointer<Nodo<T>> low, MPointer<Nodo<T>> high) {
+template <typename T, typename P>
+void quickSort(VistaNodo<T, P> low, VistaNodo<T, P> high) {
     if (high != nullptr && low != high && low != high->siguiente) {
-        MPointer<Nodo<T>> p = particion(low, high);  // Encuentra el pivote.
-        quickSort(low, p->anterior);  // Ordena la sublista izquierda.
-        quickSort(p->siguiente, high);  // Ordena la sublista derecha.
+        VistaNodo<T, P> p = particion(low, high);  // Encuentra el pivote.
+        quickSort(low, VistaNodo<T, P>(p->anterior));  // Ordena la sublista izquierda.
+        quickSort(VistaNodo<T, P>(p->siguiente), high);  // Ordena la sublista derecha.
+    }
+}
+
+// Los recorridos usan vistas: ordenar no modifica ningún contador de referencias.
+template <typename T, typename P>
+void quickSort(const EnlaceNodo<T, P>& low, const EnlaceNodo<T, P>& high) {
+    quickSort(VistaNodo<T, P>(low), VistaNodo<T, P>(high));
+}
+
+// Mezcla estable de dos cadenas ordenadas, enlazadas solo por `siguiente`
+// Qué sucede: Toma siempre el menor de los dos primeros nodos y lo engancha al final del resultado.
+// Por qué sucede: Se mueven los MPointer de los enlaces; los datos no se copian ni se intercambian.
+// Qué deberíamos esperar: Ante valores iguales gana `a`, así que el orden original se conserva.
+template <typename T, typename P>
+EnlaceNodo<T, P> mezclar(EnlaceNodo<T, P> a, EnlaceNodo<T, P> b) {
+    EnlaceNodo<T, P> resultado(nullptr);
+    EnlaceNodo<T, P>* final = std::addressof(resultado);  // Enlace vacío donde va el próximo nodo.
+    while (a != nullptr && b != nullptr) {
+        EnlaceNodo<T, P>& elegido = (b->data < a->data) ? b : a;
+        *final = std::move(elegido);  // El nodo elegido pasa al resultado.
+        elegido = std::move((*final)->siguiente);  // Su cadena avanza al nodo siguiente.
+        final = std::addressof((*final)->siguiente);
+    }
+    *final = std::move(a != nullptr ? a : b);  // Lo que queda ya está ordenado.
+    return resultado;
+}
+
+// Ordena una cadena enlazada solo por `siguiente` (sus `anterior` ya deben estar vacíos)
+// Qué sucede: Ordena de abajo hacia arriba: separa los nodos de a uno y los mezcla en cadenas de
+// 1, 2, 4... nodos, como un contador binario, sin recursión.
+// Por qué sucede: Solo mueve enlaces, sin tocar contadores, así que varias cadenas disjuntas pueden
+// ordenarse a la vez en hilos distintos.
+// Qué deberíamos esperar: Devuelve la cadena ordenada de forma estable.
+template <typename T, typename P>
+EnlaceNodo<T, P> ordenarCadena(EnlaceNodo<T, P> resto) {
+    std::vector<EnlaceNodo<T, P>> cadenas;  // `cadenas[i]` está vacía o tiene 2^i nodos.
+    while (resto != nullptr) {
+        EnlaceNodo<T, P> cadena = std::move(resto);  // Separa el primer nodo del resto.
+        resto = std::move(cadena->siguiente);
+
+        // Las cadenas guardadas son anteriores a la nueva, por eso van primero en la mezcla.
+        std::size_t i = 0;
+        for (; i < cadenas.size() && cadenas[i] != nullptr; i++) {
+            cadena = mezclar(std::move(cadenas[i]), std::move(cadena));
+        }
+        if (i == cadenas.size()) {
+            cadenas.push_back(std::move(cadena));
+        } else {
+            cadenas[i] = std::move(cadena);
+        }
     }
+
+    // Las cadenas más altas tienen los nodos más antiguos.
+    EnlaceNodo<T, P> ordenada(nullptr);
+    for (EnlaceNodo<T, P>& cadena : cadenas) {
+        if (cadena != nullptr) {
+            ordenada = mezclar(std::move(cadena), std::move(ordenada));
+        }
+    }
+    return ordenada;
+}
+
+// Suelta los enlaces `anterior` y `tail`, dejando la lista como una cadena por `siguiente`;
+// devuelve la cantidad de nodos
+template <typename T, typename P>
+std::size_t soltarAnteriores(const EnlaceNodo<T, P>& head, EnlaceNodo<T, P>& tail) {
+    tail = nullptr;
+    std::size_t cantidad = 0;
+    for (VistaNodo<T, P> actual = head; actual != nullptr; actual = actual->siguiente) {
+        actual->anterior = nullptr;
+        cantidad++;
+    }
+    return cantidad;
+}
+
+// Reconstruye los enlaces `anterior` desde `head` y ubica el último nodo en `tail`
+template <typename T, typename P>
+void enlazarAnteriores(const EnlaceNodo<T, P>& head, EnlaceNodo<T, P>& tail) {
+    VistaNodo<T, P> previo;
+    for (VistaNodo<T, P> actual = head; actual != nullptr; actual = actual->siguiente) {
+        actual->anterior = EnlaceNodo<T, P>(previo);
+        previo = actual;
+    }
+    tail = EnlaceNodo<T, P>(previo);
+}
+
+// Implementación de MergeSort para lista doblemente enlazada
+// Qué sucede: Suelta los enlaces `anterior`, ordena la cadena con `ordenarCadena` y los reconstruye.
+// Por qué sucede: Reenlaza los nodos en lugar de copiar `data`, así que el costo no depende del tamaño
+// de T, y es O(n log n) incluso con la lista ya ordenada, donde QuickSort degenera.
+// Qué deberíamos esperar: La lista queda ordenada de forma estable, con `head` y `tail` en sus extremos.
+template <typename T, typename P>
+void mergeSort(EnlaceNodo<T, P>& head, EnlaceNodo<T, P>& tail) {
+    soltarAnteriores(head, tail);
+    head = ordenarCadena(std::move(head));
+    enlazarAnteriores(head, tail);
+}
+
+// Implementación de MergeSort paralelo para lista doblemente enlazada
+// Qué sucede: Corta la lista en tramos (varios por hilo, para que el robo de tareas reparta la carga),
+// ordena cada tramo en una tarea del pool y mezcla los tramos de a pares, también en paralelo, hasta
+// que queda uno solo. Las listas de hasta `corte` nodos se ordenan en el hilo que llama.
+// Por qué sucede: Las tareas solo mueven enlaces entre nodos de su propio tramo; los contadores de
+// referencias se tocan al cortar y al reconstruir `anterior`, siempre desde el hilo que llama, así que
+// no hace falta MPOINTER_ATOMIC_REFCOUNT.
+// Qué deberíamos esperar: El mismo resultado estable que `mergeSort`. Si el recolector en segundo
+// plano está activo, el hilo que llama debe estar dentro de una MPointerGC::SeccionMutador.
+template <typename T, typename P>
+void mergeSortParalelo(EnlaceNodo<T, P>& head, EnlaceNodo<T, P>& tail, PoolTareas& pool, std::size_t corte = 1u << 14) {
+    std::size_t cantidad = soltarAnteriores(head, tail);
+    std::size_t tramos = static_cast<std::size_t>(pool.hilos()) * 4;
+    if (corte == 0) {
+        corte = 1;
+    }
+    if (cantidad / corte < tramos) {
+        tramos = cantidad / corte;
+    }
+    if (tramos <= 1) {
+        head = ordenarCadena(std::move(head));
+        enlazarAnteriores(head, tail);
+        return;
+    }
+
+    // Corta la cadena en tramos de largo parecido.
+    std::vector<EnlaceNodo<T, P>> cadenas;
+    cadenas.reserve(tramos);
+    EnlaceNodo<T, P> resto = std::move(head);
+    for (std::size_t i = 0; i < tramos; i++) {
+        std::size_t largo = cantidad / tramos + (i < cantidad % tramos ? 1 : 0);
+        VistaNodo<T, P> ultimo = resto;
+        for (std::size_t j = 1; j < largo; j++) {
+            ultimo = ultimo->siguiente;
+        }
+        EnlaceNodo<T, P> siguienteTramo = std::move(ultimo->siguiente);
+        cadenas.push_back(std::move(resto));
+        resto = std::move(siguienteTramo);
+    }
+
+    {
+        GrupoTareas grupo(pool);
+        for (EnlaceNodo<T, P>& cadena : cadenas) {
+            EnlaceNodo<T, P>* tramo = std::addressof(cadena);
+            grupo.enviar([tramo] { *tramo = ordenarCadena(std::move(*tramo)); });
+        }
+        grupo.esperar();
+    }
+
+    // Mezcla por niveles: el tramo de la izquierda va primero para conservar la estabilidad.
+    while (cadenas.size() > 1) {
+        std::size_t pares = cadenas.size() / 2;
+        {
+            GrupoTareas grupo(pool);
+            for (std::size_t i = 0; i < pares; i++) {
+                EnlaceNodo<T, P>* izquierda = std::addressof(cadenas[2 * i]);
+                EnlaceNodo<T, P>* derecha = std::addressof(cadenas[2 * i + 1]);
+                grupo.enviar([izquierda, derecha] { *izquierda = mezclar(std::move(*izquierda), std::move(*derecha)); });
+            }
+            grupo.esperar();
+        }
+        for (std::size_t i = 0; i < pares; i++) {
+            cadenas[i] = std::move(cadenas[2 * i]);
+        }
+        if (cadenas.size() % 2 == 1) {
+            cadenas[pares] = std::move(cadenas.back());
+            cadenas.resize(pares + 1);
+        } else {
+            cadenas.resize(pares);
+        }
+    }
+    head = std::move(cadenas[0]);
+    enlazarAnteriores(head, tail);
 }
 
 // Implementación de BubbleSort para lista doblemente enlazada
 // Qué sucede: Recorre la lista repetidamente y mueve los elementos más grandes hacia el final.
 // Por qué sucede: Utiliza el algoritmo BubbleSort para ordenar la lista.
 // Qué deberíamos esperar: La lista se ordena completamente.
-template <typename T>
-void bubbleSort(MPointer<Nodo<T>> head) {
+template <typename T, typename P>
+void bubbleSort(const EnlaceNodo<T, P>& head) {
     bool swapped;  // Indica si hubo intercambios.
-    MPointer<Nodo<T>> actual;
+    VistaNodo<T, P> actual;
 
     do {
         swapped = false;
@@ -59,13 +244,13 @@ void bubbleSort(MPointer<Nodo<T>> head) {
 // Qué sucede: Inserta cada elemento en su posición correcta dentro de la lista ya ordenada.
 // Por qué sucede: Utiliza el algoritmo InsertionSort para ordenar la lista.
 // Qué deberíamos esperar: La lista se ordena completamente.
-template <typename T>
-void insertionSort(MPointer<Nodo<T>> head) {
-    MPointer<Nodo<T>> actual = head->siguiente;  // Comienza desde el segundo nodo.
+template <typename T, typename P>
+void insertionSort(const EnlaceNodo<T, P>& head) {
+    VistaNodo<T, P> actual = head->siguiente;  // Comienza desde el segundo nodo.
 
     while (actual != nullptr) {
         T key = actual->data;  // Almacena el valor del nodo actual.
-        MPointer<Nodo<T>> j = actual->anterior;  // Comienza desde el nodo anterior.
+        VistaNodo<T, P> j = actual->anterior;  // Comienza desde el nodo anterior.
 
         while (j != nullptr && j->data > key) {  // Mueve los elementos mayores hacia adelante.
             j->siguiente->data = j->data;  // Mueve el valor hacia adelante.
@@ -82,4 +267,599 @@ void insertionSort(MPointer<Nodo<T>> head) {
     }
 }
 
+namespace detalle {
+
+// Entero sin signo del mismo tamaño que T
+template <std::size_t Bytes>
+struct EnteroSinSigno;
+
+template <>
+struct EnteroSinSigno<1> {
+    using Tipo = std::uint8_t;
+};
+
+template <>
+struct EnteroSinSigno<2> {
+    using Tipo = std::uint16_t;
+};
+
+template <>
+struct EnteroSinSigno<4> {
+    using Tipo = std::uint32_t;
+};
+
+template <>
+struct EnteroSinSigno<8> {
+    using Tipo = std::uint64_t;
+};
+
+// Indica si T se ordena por radix: enteros de 1 a 8 bytes y flotantes IEEE 754 de 4 u 8 bytes
+template <typename T>
+constexpr bool ordenablePorRadix() {
+    if constexpr (std::is_integral<T>::value) {
+        return sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8;
+    } else if constexpr (std::is_floating_point<T>::value) {
+        return std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8);
+    } else {
+        return false;
+    }
+}
+
+// Clave sin signo cuyo orden como entero es el orden de T
+// Con signo se invierte el bit de signo, así los negativos quedan antes. En un flotante negativo se
+// invierten todos los bits (a mayor magnitud, menor clave) y en uno positivo solo el de signo. Los NaN
+// quedan en los extremos según su bit de signo, y -0.0 antes que +0.0.
+template <typename T>
+struct ClaveRadix {
+    using Tipo = typename EnteroSinSigno<sizeof(T)>::Tipo;
+    static constexpr Tipo SIGNO = static_cast<Tipo>(Tipo(1) << (8 * sizeof(T) - 1));
+
+    static Tipo codificar(T valor) {
+        Tipo bits;
+        std::memcpy(&bits, &valor, sizeof(T));
+        if constexpr (std::is_floating_point<T>::value) {
+            return (bits & SIGNO) ? static_cast<Tipo>(~bits) : static_cast<Tipo>(bits | SIGNO);
+        } else if constexpr (std::is_signed<T>::value) {
+            return static_cast<Tipo>(bits ^ SIGNO);
+        } else {
+            return bits;
+        }
+    }
+
+    static T decodificar(Tipo clave) {
+        Tipo bits;
+        if constexpr (std::is_floating_point<T>::value) {
+            bits = (clave & SIGNO) ? static_cast<Tipo>(clave & ~SIGNO) : static_cast<Tipo>(~clave);
+        } else if constexpr (std::is_signed<T>::value) {
+            bits = static_cast<Tipo>(clave ^ SIGNO);
+        } else {
+            bits = clave;
+        }
+        T valor;
+        std::memcpy(&valor, &bits, sizeof(T));
+        return valor;
+    }
+};
+
+// RadixSort LSD de claves sin signo, por dígitos de 8 bits
+// Un solo recorrido cuenta los dígitos de todas las posiciones a la vez; después, cada pasada reparte
+// las claves entre el arreglo y un auxiliar. Las pasadas en las que todas las claves tienen el mismo
+// dígito (por ejemplo, los bytes altos de enteros chicos) se saltean.
+template <typename Clave>
+void radixSortClaves(std::vector<Clave>& claves) {
+    constexpr std::size_t DIGITOS = sizeof(Clave);
+    const std::size_t n = claves.size();
+    if (n < 256) {  // Con pocas claves, preparar 256 cubetas por dígito cuesta más que compararlas.
+        std::sort(claves.begin(), claves.end());
+        return;
+    }
+    std::size_t conteos[DIGITOS][256] = {};
+    for (Clave clave : claves) {
+        for (std::size_t digito = 0; digito < DIGITOS; digito++) {
+            conteos[digito][(clave >> (8 * digito)) & 0xFF]++;
+        }
+    }
+
+    std::vector<Clave> auxiliar(n);
+    Clave* origen = claves.data();
+    Clave* destino = auxiliar.data();
+    for (std::size_t digito = 0; digito < DIGITOS; digito++) {
+        std::size_t* conteo = conteos[digito];
+        if (conteo[(origen[0] >> (8 * digito)) & 0xFF] == n) {
+            continue;
+        }
+        std::size_t posicion = 0;
+        for (std::size_t cubeta = 0; cubeta < 256; cubeta++) {  // Conteos a posiciones iniciales.
+            std::size_t cantidad = conteo[cubeta];
+            conteo[cubeta] = posicion;
+            posicion += cantidad;
+        }
+        for (std::size_t i = 0; i < n; i++) {
+            destino[conteo[(origen[i] >> (8 * digito)) & 0xFF]++] = origen[i];
+        }
+        std::swap(origen, destino);
+    }
+    if (origen != claves.data()) {
+        claves.swap(auxiliar);
+    }
+}
+
+}  // namespace detalle
+
+// Implementación de RadixSort para lista doblemente enlazada
+// Qué sucede: Para enteros y flotantes, copia las claves de los nodos a un arreglo contiguo, las ordena
+// con RadixSort LSD y las vuelve a escribir en los nodos en orden. Para otros T usa mergeSort.
+// Por qué sucede: Con claves aritméticas no hacen falta comparaciones: cada pasada es un recorrido
+// secuencial de un arreglo, y los nodos se recorren solo dos veces, sin saltos hacia atrás.
+// Qué deberíamos esperar: La lista ordenada en O(n) para claves aritméticas, con `head` y `tail` en
+// los mismos nodos (solo cambian los valores). La elección se hace al compilar.
+template <typename T, typename P>
+void radixSort(EnlaceNodo<T, P>& head, EnlaceNodo<T, P>& tail) {
+    if constexpr (detalle::ordenablePorRadix<T>()) {
+        using Clave = detalle::ClaveRadix<T>;
+        std::vector<typename Clave::Tipo> claves;
+        for (VistaNodo<T, P> actual = head; actual != nullptr; actual = actual->siguiente) {
+            claves.push_back(Clave::codificar(actual->data));
+        }
+        detalle::radixSortClaves(claves);
+        std::size_t i = 0;
+        for (VistaNodo<T, P> actual = head; actual != nullptr; actual = actual->siguiente) {
+            actual->data = Clave::decodificar(claves[i++]);
+        }
+    } else {
+        mergeSort(head, tail);
+    }
+}
+
+// Núcleo de QuickSort sobre claves contiguas, para quickSortContiguo
+namespace detalle {
+
+// Clave entera con signo cuyo orden es el de T: la clave de radix con el bit de signo invertido, o
+// extendida a 32 bits si T tiene 1 o 2 bytes. Así cada comparación del núcleo es un `<` entre enteros,
+// que tiene instrucción vectorial (AVX2 compara con signo) para cualquier T aritmético.
+template <typename T>
+struct ClaveParticion {
+    using Radix = ClaveRadix<T>;
+    using Origen = typename Radix::Tipo;
+    using Tipo = typename std::conditional<(sizeof(T) <= 4), std::int32_t, std::int64_t>::type;
+    static constexpr bool EXTENDIDA = sizeof(Origen) < sizeof(Tipo);
+
+    static Tipo codificar(T valor) {
+        Origen clave = Radix::codificar(valor);
+        return static_cast<Tipo>(EXTENDIDA ? clave : static_cast<Origen>(clave ^ Radix::SIGNO));
+    }
+
+    static T decodificar(Tipo clave) {
+        Origen bits = static_cast<Origen>(clave);
+        return Radix::decodificar(EXTENDIDA ? bits : static_cast<Origen>(bits ^ Radix::SIGNO));
+    }
+};
+
+// Partición de Lomuto sin saltos: deja a la izquierda las claves menores que `pivote` (o menores o
+// iguales, con `Incluir`) y devuelve cuántas son
+// Cada paso intercambia siempre y avanza el borde según la comparación, así que el procesador no
+// predice nada: con claves al azar, la versión con `if` falla la predicción la mitad de las veces.
+template <bool Incluir, typename Clave>
+std::size_t particionEscalar(Clave* claves, std::size_t n, Clave pivote) {
+    std::size_t borde = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        Clave clave = claves[i];
+        bool izquierda = Incluir ? !(pivote < clave) : clave < pivote;
+        claves[i] = claves[borde];
+        claves[borde] = clave;
+        borde += izquierda;
+    }
+    return borde;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MPOINTER_PARTICION_AVX2 1
+
+// Para cada máscara de carriles que van a la izquierda, el orden en que _mm256_permutevar8x32_epi32
+// tiene que tomar los carriles de 32 bits para dejarlos primero (y los de la derecha después)
+struct TablasPermutacion {
+    std::uint8_t carriles32[256][8];
+    std::uint8_t carriles64[16][8];
+
+    TablasPermutacion() {
+        for (unsigned mascara = 0; mascara < 256; mascara++) {
+            int k = 0;
+            for (int carril = 0; carril < 8; carril++) {
+                if (mascara & (1u << carril)) carriles32[mascara][k++] = static_cast<std::uint8_t>(carril);
+            }
+            for (int carril = 0; carril < 8; carril++) {
+                if (!(mascara & (1u << carril))) carriles32[mascara][k++] = static_cast<std::uint8_t>(carril);
+            }
+        }
+        for (unsigned mascara = 0; mascara < 16; mascara++) {  // Un carril de 64 bits son dos de 32.
+            int k = 0;
+            for (int pasada = 0; pasada < 2; pasada++) {
+                for (int carril = 0; carril < 4; carril++) {
+                    if (((mascara >> carril) & 1u) != static_cast<unsigned>(pasada)) {
+                        carriles64[mascara][k++] = static_cast<std::uint8_t>(2 * carril);
+                        carriles64[mascara][k++] = static_cast<std::uint8_t>(2 * carril + 1);
+                    }
+                }
+            }
+        }
+    }
+};
+
+inline const TablasPermutacion& tablasPermutacion() {
+    static const TablasPermutacion tablas;
+    return tablas;
+}
+
+// Instrucciones AVX2 para claves de 32 y de 64 bits. Se compilan con `target` aunque el resto del
+// programa no use -mavx2, y solo se llaman si avx2Disponible().
+template <typename Clave>
+struct VectorAVX2;
+
+template <>
+struct VectorAVX2<std::int32_t> {
+    static constexpr std::size_t CARRILES = 8;
+
+    // Máscara con un bit por carril que va a la izquierda
+    template <bool Incluir>
+    __attribute__((target("avx2"))) static unsigned izquierda(__m256i claves, __m256i pivote) {
+        if (Incluir) {
+            return ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(claves, pivote)))) & 0xFFu;
+        }
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivote, claves))));
+    }
+
+    __attribute__((target("avx2"))) static __m256i repetir(std::int32_t clave) {
+        return _mm256_set1_epi32(clave);
+    }
+
+    static const std::uint8_t (*permutaciones())[8] {
+        return tablasPermutacion().carriles32;
+    }
+};
+
+template <>
+struct VectorAVX2<std::int64_t> {
+    static constexpr std::size_t CARRILES = 4;
+
+    template <bool Incluir>
+    __attribute__((target("avx2"))) static unsigned izquierda(__m256i claves, __m256i pivote) {
+        if (Incluir) {
+            return ~static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(claves, pivote)))) & 0xFu;
+        }
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(pivote, claves))));
+    }
+
+    __attribute__((target("avx2"))) static __m256i repetir(std::int64_t clave) {
+        return _mm256_set1_epi64x(clave);
+    }
+
+    static const std::uint8_t (*permutaciones())[8] {
+        return tablasPermutacion().carriles64;
+    }
+};
+
+// Reparte un vector de claves: las de la izquierda se escriben en `izquierda` y las de la derecha
+// terminan justo antes de `derecha`. Las dos escrituras son del vector entero (sin máscara), así que
+// hace falta espacio libre de dos vectores entre los bordes; lo que sobra se pisa en pasos siguientes.
+template <bool Incluir, typename Clave>
+__attribute__((target("avx2,popcnt"))) inline void repartirAVX2(__m256i claves, __m256i pivote, const std::uint8_t (*permutaciones)[8],
+                                                                Clave*& izquierda, Clave*& derecha) {
+    using Vector = VectorAVX2<Clave>;
+    unsigned mascara = Vector::template izquierda<Incluir>(claves, pivote);
+    __m256i orden = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(permutaciones[mascara])));
+    __m256i repartidas = _mm256_permutevar8x32_epi32(claves, orden);
+    std::size_t cantidad = static_cast<std::size_t>(_mm_popcnt_u32(mascara));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(izquierda), repartidas);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(derecha - Vector::CARRILES), repartidas);
+    izquierda += cantidad;
+    derecha -= Vector::CARRILES - cantidad;
+}
+
+// Partición vectorial, con el mismo resultado que particionEscalar en cuanto a qué claves quedan de
+// cada lado (no en su orden dentro de cada lado)
+// Qué sucede: Lee las claves de a un vector, en orden, y las reparte en `auxiliar` con una permutación
+// de tabla: las de la izquierda desde el principio y las de la derecha desde el final. Las últimas, que
+// no dejan espacio para escribir vectores enteros, se reparten una por una. Después copia `auxiliar`
+// sobre `claves`.
+// Por qué sucede: En el lugar habría que leer del lado que tenga más hueco, y esa dirección depende de
+// la permutación anterior: cada vector esperaría al anterior. Fuera de lugar las lecturas no dependen
+// de nada y la única cadena entre vectores es sumar al borde izquierdo.
+// Qué deberíamos esperar: Sin saltos que dependan de las claves; 8 claves de 32 bits (o 4 de 64) por
+// comparación, más una copia secuencial de n claves.
+template <bool Incluir, typename Clave>
+__attribute__((target("avx2,popcnt"))) std::size_t particionAVX2(Clave* claves, std::size_t n, Clave pivote, Clave* auxiliar) {
+    using Vector = VectorAVX2<Clave>;
+    constexpr std::size_t C = Vector::CARRILES;
+    const __m256i repetido = Vector::repetir(pivote);
+    const std::uint8_t (*permutaciones)[8] = Vector::permutaciones();
+    Clave* izquierda = auxiliar;
+    Clave* derecha = auxiliar + n;
+    std::size_t i = 0;
+    for (; n - i >= 2 * C; i += C) {
+        repartirAVX2<Incluir>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(claves + i)), repetido, permutaciones, izquierda, derecha);
+    }
+    // Se escribe en los dos bordes y avanza uno: el hueco entre ellos es igual a lo que falta leer.
+    for (; i < n; i++) {
+        Clave clave = claves[i];
+        bool aIzquierda = Incluir ? !(pivote < clave) : clave < pivote;
+        *izquierda = clave;
+        *(derecha - 1) = clave;
+        izquierda += aIzquierda;
+        derecha -= !aIzquierda;
+    }
+    std::memcpy(claves, auxiliar, n * sizeof(Clave));
+    return static_cast<std::size_t>(izquierda - auxiliar);
+}
+
+// Indica si el procesador en el que corre el programa tiene AVX2 (se consulta una sola vez)
+inline bool avx2Disponible() {
+    static const bool disponible = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    return disponible;
+}
+#else
+inline bool avx2Disponible() {
+    return false;
+}
+#endif
+
+// Partición con el núcleo vectorial si hay `auxiliar` (de al menos n claves), o con el escalar si no
+template <bool Incluir, typename Clave>
+std::size_t particionClaves(Clave* claves, std::size_t n, Clave pivote, Clave* auxiliar) {
+#ifdef MPOINTER_PARTICION_AVX2
+    if (auxiliar != nullptr && n >= 4 * VectorAVX2<Clave>::CARRILES) {  // Con menos, manda el resto escalar.
+        return particionAVX2<Incluir>(claves, n, pivote, auxiliar);
+    }
+#else
+    (void)auxiliar;
+#endif
+    return particionEscalar<Incluir>(claves, n, pivote);
+}
+
+// Mediana de tres claves
+template <typename Clave>
+Clave mediana(Clave a, Clave b, Clave c) {
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+// Introsort de claves contiguas
+// Qué sucede: Parte por la mediana de tres (el primero, el del medio y el último) con las claves
+// menores a la izquierda, recurre sobre el lado más corto y sigue iterando sobre el otro. Si ninguna
+// clave es menor que el pivote, el pivote es el mínimo: se apartan las iguales a él (como en pdqsort)
+// y no se vuelven a mirar. Los tramos cortos se ordenan por inserción.
+// Por qué sucede: Apartar las iguales evita el caso cuadrático con muchos repetidos, y el límite de
+// profundidad (HeapSort cuando se agota) el de las medianas desafortunadas.
+// Qué deberíamos esperar: O(n log n) en cualquier entrada, con pila de O(log n).
+template <typename Clave>
+void ordenarClaves(Clave* claves, std::size_t n, Clave* auxiliar, int profundidad) {
+    constexpr std::size_t CORTE_INSERCION = 16;
+    while (n > CORTE_INSERCION) {
+        if (profundidad-- == 0) {
+            std::make_heap(claves, claves + n);
+            std::sort_heap(claves, claves + n);
+            return;
+        }
+        Clave pivote = mediana(claves[0], claves[n / 2], claves[n - 1]);
+        std::size_t menores = particionClaves<false>(claves, n, pivote, auxiliar);
+        if (menores == 0) {
+            std::size_t iguales = particionClaves<true>(claves, n, pivote, auxiliar);
+            claves += iguales;
+            n -= iguales;
+            continue;
+        }
+        if (menores < n - menores) {
+            ordenarClaves(claves, menores, auxiliar, profundidad);
+            claves += menores;
+            n -= menores;
+        } else {
+            ordenarClaves(claves + menores, n - menores, auxiliar, profundidad);
+            n = menores;
+        }
+    }
+    for (std::size_t i = 1; i < n; i++) {
+        Clave clave = claves[i];
+        std::size_t hueco = i;
+        for (; hueco > 0 && clave < claves[hueco - 1]; hueco--) {
+            claves[hueco] = claves[hueco - 1];
+        }
+        claves[hueco] = clave;
+    }
+}
+
+template <typename Clave>
+void ordenarClaves(std::vector<Clave>& claves, bool vectorial) {
+    int profundidad = 0;
+    for (std::size_t n = claves.size(); n > 1; n >>= 1) {
+        profundidad += 2;
+    }
+    std::vector<Clave> auxiliar(vectorial && avx2Disponible() ? claves.size() : 0);
+    ordenarClaves(claves.data(), claves.size(), auxiliar.empty() ? nullptr : auxiliar.data(), profundidad);
+}
+
+}  // namespace detalle
+
+// Núcleo de partición que usa quickSortContiguo
+enum class NucleoParticion {
+    Automatico,  // AVX2 si el procesador lo tiene, escalar sin saltos si no
+    Escalar,  // Siempre el escalar sin saltos (para comparar, o en máquinas donde AVX2 baja la frecuencia)
+};
+
+// Implementación de QuickSort sobre un arreglo contiguo para lista doblemente enlazada
+// Qué sucede: Para enteros y flotantes, copia las claves de los nodos a un arreglo, las ordena con un
+// introsort cuya partición es vectorial (AVX2, elegida al ejecutar) o escalar sin saltos, y las vuelve
+// a escribir en los nodos en una pasada. Para otros T usa quickSort sobre los nodos.
+// Por qué sucede: La partición de quickSort sobre nodos sigue punteros y salta según cada comparación;
+// sobre un arreglo compara varias claves por instrucción y no falla predicciones.
+// Qué deberíamos esperar: El mismo resultado que quickSort (los valores en orden ascendente; solo
+// -0.0 y +0.0, que son iguales, quedan en orden fijo: primero -0.0), con `head` y `tail` en los mismos
+// nodos. Los NaN quedan en los extremos, como en radixSort.
+template <typename T, typename P>
+void quickSortContiguo(const EnlaceNodo<T, P>& head, const EnlaceNodo<T, P>& tail, NucleoParticion nucleo = NucleoParticion::Automatico) {
+    if constexpr (detalle::ordenablePorRadix<T>()) {
+        using Clave = detalle::ClaveParticion<T>;
+        std::vector<typename Clave::Tipo> claves;
+        for (VistaNodo<T, P> actual = head; actual != nullptr; actual = actual->siguiente) {
+            claves.push_back(Clave::codificar(actual->data));
+        }
+        detalle::ordenarClaves(claves, nucleo == NucleoParticion::Automatico);
+        std::size_t i = 0;
+        for (VistaNodo<T, P> actual = head; actual != nullptr; actual = actual->siguiente) {
+            actual->data = Clave::decodificar(claves[i++]);
+        }
+    } else {
+        (void)nucleo;
+        quickSort(head, tail);
+    }
+}
+
+template <typename T, std::size_t N>
+class ListaDesenrollada;  // Definida en ListaDesenrollada.h
+
+// Versiones de los algoritmos sobre iteradores bidireccionales, para contenedores que guardan los
+// elementos en arreglos (ListaDesenrollada). Igual que en las listas, intercambian valores.
+namespace detalle {
+
+// Partición de Lomuto sobre el rango cerrado [low, high], con `*high` como pivote
+// Devuelve la posición final del pivote y cuántos elementos quedaron a cada lado.
+template <typename Iterador>
+Iterador particion(Iterador low, Iterador high, std::size_t& izquierda, std::size_t& derecha) {
+    auto pivote = *high;
+    Iterador i = low;
+    izquierda = 0;
+    derecha = 0;
+    for (Iterador j = low; j != high; ++j) {
+        if (*j <= pivote) {
+            std::iter_swap(i, j);
+            ++i;
+            izquierda++;
+        } else {
+            derecha++;
+        }
+    }
+    std::iter_swap(i, high);
+    return i;
+}
+
+// QuickSort sobre el rango cerrado [low, high]
+// La recursión va siempre por el lado más corto y el más largo se sigue en el mismo ciclo, así que
+// la pila crece O(log n) aunque una entrada ordenada vuelva cuadrático el tiempo.
+template <typename Iterador>
+void quickSort(Iterador low, Iterador high) {
+    while (low != high) {
+        std::size_t izquierda;
+        std::size_t derecha;
+        Iterador p = particion(low, high, izquierda, derecha);
+        if (izquierda < derecha) {
+            if (izquierda > 1) {
+                quickSort(low, std::prev(p));
+            }
+            low = std::next(p);
+        } else {
+            if (derecha > 1) {
+                quickSort(std::next(p), high);
+            }
+            if (izquierda == 0) {
+                return;
+            }
+            high = std::prev(p);
+        }
+    }
+}
+
+// MergeSort estable sobre [primero, ultimo)
+// Los elementos se mueven a un búfer contiguo, se mezclan allí y vuelven a sus posiciones: en un
+// contenedor por arreglos no hay enlaces por elemento que reenlazar.
+template <typename Iterador>
+void mergeSort(Iterador primero, Iterador ultimo) {
+    using Valor = typename std::iterator_traits<Iterador>::value_type;
+    std::vector<Valor> bufer(std::make_move_iterator(primero), std::make_move_iterator(ultimo));
+    std::stable_sort(bufer.begin(), bufer.end());
+    std::move(bufer.begin(), bufer.end(), primero);
+}
+
+// BubbleSort sobre [primero, ultimo)
+template <typename Iterador>
+void bubbleSort(Iterador primero, Iterador ultimo) {
+    if (primero == ultimo) {
+        return;
+    }
+    bool swapped;
+    do {
+        swapped = false;
+        Iterador actual = primero;
+        for (Iterador siguiente = std::next(actual); siguiente != ultimo; actual = siguiente++) {
+            if (*actual > *siguiente) {
+                std::iter_swap(actual, siguiente);
+                swapped = true;
+            }
+        }
+        --ultimo;  // El mayor ya quedó al final.
+    } while (swapped);
+}
+
+// InsertionSort sobre [primero, ultimo)
+template <typename Iterador>
+void insertionSort(Iterador primero, Iterador ultimo) {
+    if (primero == ultimo) {
+        return;
+    }
+    for (Iterador actual = std::next(primero); actual != ultimo; ++actual) {
+        auto key = std::move(*actual);
+        Iterador hueco = actual;
+        while (hueco != primero) {
+            Iterador previo = std::prev(hueco);
+            if (!(*previo > key)) {
+                break;
+            }
+            *hueco = std::move(*previo);  // Mueve el valor hacia adelante.
+            hueco = previo;
+        }
+        *hueco = std::move(key);
+    }
+}
+
+}  // namespace detalle
+
+// Algoritmos de ordenamiento para ListaDesenrollada
+// Qué sucede: Ordenan los elementos de la lista en su lugar, sin cambiar sus nodos.
+// Por qué sucede: Cada nodo guarda un arreglo, así que se recorren con los iteradores de la lista.
+// Qué deberíamos esperar: El mismo resultado que las versiones para ListaDoble; mergeSort es estable.
+template <typename T, std::size_t N>
+void quickSort(ListaDesenrollada<T, N>& lista) {
+    if (!lista.vacia()) {
+        detalle::quickSort(lista.begin(), std::prev(lista.end()));
+    }
+}
+
+template <typename T, std::size_t N>
+void mergeSort(ListaDesenrollada<T, N>& lista) {
+    detalle::mergeSort(lista.begin(), lista.end());
+}
+
+template <typename T, std::size_t N>
+void bubbleSort(ListaDesenrollada<T, N>& lista) {
+    detalle::bubbleSort(lista.begin(), lista.end());
+}
+
+template <typename T, std::size_t N>
+void insertionSort(ListaDesenrollada<T, N>& lista) {
+    detalle::insertionSort(lista.begin(), lista.end());
+}
+
+// Con claves aritméticas, RadixSort sobre una copia contigua; si no, mergeSort
+template <typename T, std::size_t N>
+void radixSort(ListaDesenrollada<T, N>& lista) {
+    if constexpr (detalle::ordenablePorRadix<T>()) {
+        using Clave = detalle::ClaveRadix<T>;
+        std::vector<typename Clave::Tipo> claves;
+        claves.reserve(lista.tamano());
+        for (const T& valor : lista) {
+            claves.push_back(Clave::codificar(valor));
+        }
+        detalle::radixSortClaves(claves);
+        std::transform(claves.begin(), claves.end(), lista.begin(), Clave::decodificar);
+    } else {
+        detalle::mergeSort(lista.begin(), lista.end());
+    }
+}
+
 #endif
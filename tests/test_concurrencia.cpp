@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include "ListaConcurrente.h"
+#include "MPointer.h"
+#include "PoolTareas.h"
+
+// Prueba para verificar el registro concurrente en el Garbage Collector
+// Qué sucede: Varios hilos registran punteros a la vez y luego otros hilos los eliminan.
+// Por qué sucede: Esta prueba verifica que los fragmentos del registro no pierdan ni dupliquen entradas.
+// Qué deberíamos esperar: Todos los handles son distintos y el registro vuelve a su tamaño inicial.
+TEST(ConcurrenciaTest, RegistroConcurrenteTest) {
+    const int hilos = 8;
+    const int porHilo = 2000;
+    MPointerGC& gc = MPointerGC::getInstance();
+    std::size_t inicial = gc.size();
+    std::vector<std::vector<MPointerGC::Handle>> handles(hilos);
+    BloqueControl* bloque = BloqueEnLinea<int>::crear(0);  // El mismo bloque se registra muchas veces.
+
+    std::vector<std::thread> trabajadores;
+    for (int h = 0; h < hilos; h++) {
+        trabajadores.emplace_back([&, h] {
+            for (int i = 0; i < porHilo; i++) {
+                handles[h].push_back(gc.registerPointer(bloque));
+                if (i % 2 == 1) {  // Elimina la mitad desde el mismo hilo.
+                    gc.deregisterPointer(handles[h][i - 1]);
+                }
+            }
+        });
+    }
+    for (std::thread& t : trabajadores) {
+        t.join();
+    }
+
+    std::set<MPointerGC::Handle> unicos;
+    for (const auto& lista : handles) {
+        unicos.insert(lista.begin(), lista.end());
+    }
+    EXPECT_EQ(unicos.size(), static_cast<std::size_t>(hilos * porHilo));  // Los handles vivos no se repiten.
+    EXPECT_EQ(gc.size(), inicial + hilos * porHilo / 2);
+
+    // Cada hilo elimina los punteros que registró otro hilo.
+    trabajadores.clear();
+    for (int h = 0; h < hilos; h++) {
+        trabajadores.emplace_back([&, h] {
+            const auto& ajenos = handles[(h + 1) % hilos];
+            for (int i = 1; i < porHilo; i += 2) {
+                gc.deregisterPointer(ajenos[i]);
+            }
+        });
+    }
+    for (std::thread& t : trabajadores) {
+        t.join();
+    }
+    EXPECT_EQ(gc.size(), inicial);
+    bloque->destruir();
+}
+
+// Prueba para verificar los contadores atómicos
+// Qué sucede: Varios hilos copian y destruyen el mismo MPointer con la política compartida muchas veces.
+// Por qué sucede: Esta prueba verifica que los incrementos y decrementos concurrentes no se pierdan.
+// Qué deberíamos esperar: Al terminar, el contador vuelve a 1 y el objeto sigue registrado.
+TEST(ConcurrenciaTest, ContadorAtomicoTest) {
+    using Compartido = MPointer<int, PoliticaCompartida>;
+    Compartido compartido = Compartido::New(42);
+    std::vector<std::thread> trabajadores;
+    for (int h = 0; h < 8; h++) {
+        trabajadores.emplace_back([&compartido] {
+            for (int i = 0; i < 100000; i++) {
+                Compartido copia = compartido;
+                Compartido otra = copia;
+                EXPECT_EQ(*otra, 42);
+            }
+        });
+    }
+    for (std::thread& t : trabajadores) {
+        t.join();
+    }
+    EXPECT_EQ(compartido.useCount(), 1);
+    EXPECT_TRUE(MPointerGC::getInstance().isRegistered(compartido.getId()));
+}
+
+// Prueba para verificar el pool con tareas anidadas
+// Qué sucede: Cada tarea crea su propio grupo de subtareas y lo espera; una de ellas lanza una excepción.
+// Por qué sucede: Quien espera un grupo ejecuta tareas pendientes, así que anidar no bloquea los hilos.
+// Qué deberíamos esperar: Se ejecutan todas las subtareas y la excepción llega a quien espera.
+TEST(ConcurrenciaTest, PoolTareasTest) {
+    PoolTareas pool(4);
+    std::atomic<int> ejecutadas{0};
+    {
+        GrupoTareas grupo(pool);
+        for (int i = 0; i < 16; i++) {
+            grupo.enviar([&pool, &ejecutadas] {
+                GrupoTareas subgrupo(pool);
+                for (int j = 0; j < 16; j++) {
+                    subgrupo.enviar([&ejecutadas] { ejecutadas.fetch_add(1); });
+                }
+                subgrupo.esperar();
+            });
+        }
+        grupo.esperar();
+    }
+    EXPECT_EQ(ejecutadas.load(), 256);
+
+    GrupoTareas conError(pool);
+    conError.enviar([] { throw std::runtime_error("falla"); });
+    EXPECT_THROW(conError.esperar(), std::runtime_error);
+}
+
+// Prueba de la lista concurrente con varios productores y un consumidor a la vez
+// Qué sucede: Ocho hilos agregan valores (uno por uno y por lotes) mientras el hilo principal los extrae.
+// Por qué sucede: Los productores solo compiten por el `exchange` de la cola; el consumidor no usa candados.
+// Qué deberíamos esperar: Salen todos los valores, una sola vez, y los de cada productor en su orden.
+TEST(ConcurrenciaTest, ListaConcurrenteTest) {
+    const int hilos = 8;
+    const int porHilo = 20000;
+    ListaConcurrente<int> lista;
+    std::vector<std::thread> productores;
+    for (int h = 0; h < hilos; h++) {
+        productores.emplace_back([&, h] {
+            for (int i = 0; i < porHilo / 2; i++) {
+                lista.agregar(h * porHilo + i);
+            }
+            std::vector<int> lote;
+            for (int i = porHilo / 2; i < porHilo; i++) {
+                lote.push_back(h * porHilo + i);
+                if (lote.size() == 10) {
+                    lista.agregarRango(lote.begin(), lote.end());
+                    lote.clear();
+                }
+            }
+        });
+    }
+
+    std::vector<int> siguienteEsperado(hilos, 0);
+    int extraidos = 0;
+    int valor = 0;
+    while (extraidos < hilos * porHilo) {
+        if (!lista.extraer(valor)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int productor = valor / porHilo;
+        ASSERT_EQ(valor % porHilo, siguienteEsperado[productor]);  // Orden de cada productor.
+        siguienteEsperado[productor]++;
+        extraidos++;
+    }
+    for (std::thread& t : productores) {
+        t.join();
+    }
+    EXPECT_TRUE(lista.vacia());
+    EXPECT_FALSE(lista.extraer(valor));
+}
+
+// Prueba del volcado a una ListaDoble y de los valores que nadie extrajo
+// Qué sucede: Se vuelcan enteros a una ListaDoble y se destruye una lista con MPointers pendientes.
+// Por qué sucede: volcarEn agrega por lotes; el destructor destruye los valores que quedaron en los nodos.
+// Qué deberíamos esperar: La ListaDoble con los valores en orden, y los MPointers pendientes liberados.
+TEST(ConcurrenciaTest, ListaConcurrenteVolcadoTest) {
+    ListaConcurrente<int> enteros;
+    std::vector<int> valores(1000);
+    std::iota(valores.begin(), valores.end(), 0);
+    enteros.agregarRango(valores.begin(), valores.end());
+    ListaDoble<int> destino{-1};
+    EXPECT_EQ(enteros.volcarEn(destino, 10), 10u);
+    EXPECT_EQ(enteros.volcarEn(destino), 990u);
+    EXPECT_EQ(enteros.volcarEn(destino), 0u);
+    EXPECT_EQ(destino.tamano(), 1001u);
+    EXPECT_TRUE(std::equal(std::next(destino.begin()), destino.end(), valores.begin(), valores.end()));
+
+    using Compartido = MPointer<int, PoliticaCompartida>;
+    MPointerGC& gc = MPointerGC::getInstance();
+    std::size_t vivos = gc.stats().objetosVivos;
+    {
+        ListaConcurrente<Compartido> punteros;
+        for (int i = 0; i < 100; i++) {
+            punteros.agregar(Compartido::New(i));
+        }
+        Compartido primero(nullptr);
+        ASSERT_TRUE(punteros.extraer(primero));
+        EXPECT_EQ(*primero, 0);
+        EXPECT_EQ(gc.stats().objetosVivos, vivos + 100);
+    }
+    EXPECT_EQ(gc.stats().objetosVivos, vivos);
+}
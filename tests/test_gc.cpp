@@ -0,0 +1,450 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ListaDoble.h"
+
+// Prueba para verificar que el GC libera los ciclos de una lista destruida
+// Qué sucede: Se crea una lista de varios nodos, se destruye y se ejecuta el Garbage Collector.
+// Por qué sucede: Los enlaces siguiente/anterior forman ciclos que el contador de referencias no libera.
+// Qué deberíamos esperar: El GC libera todos los nodos y el registro vuelve a su tamaño inicial.
+TEST(GarbageCollectorTest, CollectsListCyclesTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();  // Parte de un registro sin basura de otras pruebas.
+    std::size_t inicial = gc.size();
+    {
+        ListaDoble<int> lista;
+        for (int i = 0; i < 5; i++) {
+            lista.agregar(i);
+        }
+        EXPECT_EQ(gc.size(), inicial + 5);
+    }
+    EXPECT_EQ(gc.size(), inicial + 5);  // Los ciclos mantienen vivos los nodos.
+
+    ResultadoGC resultado = gc.runGC();
+    EXPECT_EQ(resultado.objetosLiberados, 5u);
+    EXPECT_EQ(resultado.bytesLiberados, 5 * sizeof(BloqueEnLinea<Nodo<int>>));
+    EXPECT_EQ(gc.size(), inicial);
+}
+
+// Prueba de referencias débiles hacia un ciclo que recolecta el GC
+// Qué sucede: Se observa con un MWeakPointer la cabeza de una lista destruida y se ejecuta el GC.
+// Por qué sucede: El GC marca el bloque como recolectado antes de destruir el objeto, así que lock()
+// ya no puede revivirlo; el bloque se libera recién con la última referencia débil.
+// Qué deberíamos esperar: La referencia débil sigue vigente mientras el ciclo no se recolecta y vence después.
+TEST(GarbageCollectorTest, WeakPointerToCollectedCycleTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    MWeakPointer<Nodo<int>> primero;
+    {
+        ListaDoble<int> lista;
+        lista.agregar(7);
+        lista.agregar(8);
+        primero = lista.obtenerHead();
+    }
+    EXPECT_FALSE(primero.expired());
+    EXPECT_EQ(primero.lock()->data, 7);
+
+    ResultadoGC resultado = gc.runGC();
+    EXPECT_EQ(resultado.objetosLiberados, 2u);
+    EXPECT_TRUE(primero.expired());
+    EXPECT_EQ(primero.lock(), nullptr);
+}
+
+// Prueba para verificar que el GC no libera objetos alcanzables
+// Qué sucede: Se mantiene viva una lista y un nodo suelto de otra lista destruida, y se ejecuta el GC.
+// Por qué sucede: Un nodo con una referencia externa mantiene vivo todo lo que alcanza.
+// Qué deberíamos esperar: Nada alcanzable se libera y los valores siguen intactos.
+TEST(GarbageCollectorTest, KeepsReachableObjectsTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    ListaDoble<int> viva;
+    viva.agregar(1);
+    viva.agregar(2);
+
+    MPointer<Nodo<int>> medio(nullptr);
+    {
+        ListaDoble<int> destruida;
+        destruida.agregar(10);
+        destruida.agregar(20);
+        destruida.agregar(30);
+        medio = destruida.obtenerHead()->siguiente;  // Referencia externa al nodo del medio.
+    }
+
+    ResultadoGC resultado = gc.runGC();
+    EXPECT_EQ(resultado.objetosLiberados, 0u);  // El nodo del medio alcanza a sus dos vecinos.
+    EXPECT_EQ(medio->anterior->data, 10);
+    EXPECT_EQ(medio->siguiente->data, 30);
+    EXPECT_EQ(viva.obtenerHead()->siguiente->data, 2);
+
+    medio = nullptr;
+    resultado = gc.runGC();
+    EXPECT_EQ(resultado.objetosLiberados, 3u);  // Sin la referencia externa, los tres nodos son basura.
+    EXPECT_EQ(viva.obtenerTail()->data, 2);
+}
+
+// Prueba para verificar un ciclo de un solo nodo
+// Qué sucede: Un nodo se apunta a sí mismo y se suelta la única referencia externa.
+// Por qué sucede: El auto-ciclo es el caso mínimo que el contador nunca libera.
+// Qué deberíamos esperar: El GC libera el nodo.
+TEST(GarbageCollectorTest, CollectsSelfCycleTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    MPointerGC::Handle id;
+    {
+        MPointer<Nodo<int>> nodo = MPointer<Nodo<int>>::New(7);
+        nodo->siguiente = nodo;
+        id = nodo.getId();
+    }
+    EXPECT_TRUE(gc.isRegistered(id));
+    EXPECT_EQ(gc.runGC().objetosLiberados, 1u);
+    EXPECT_FALSE(gc.isRegistered(id));
+}
+
+// Prueba para verificar la recolección incremental
+// Qué sucede: Se destruyen varias listas y se ejecutan tramos con un presupuesto pequeño hasta vaciar la basura.
+// Por qué sucede: Cada tramo analiza un conjunto cerrado, así que libera ciclos completos sin ver todo el registro.
+// Qué deberíamos esperar: La suma de los tramos libera todos los nodos y el registro vuelve a su tamaño inicial.
+TEST(GarbageCollectorTest, IncrementalSlicesTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    std::size_t inicial = gc.size();
+    for (int l = 0; l < 20; l++) {
+        ListaDoble<int> lista;
+        for (int i = 0; i < 50; i++) {
+            lista.agregar(i);
+        }
+    }
+    ListaDoble<int> viva;
+    viva.agregar(1);
+    ASSERT_EQ(gc.size(), inicial + 1001);
+
+    std::size_t liberados = 0;
+    for (int intento = 0; intento < 1000 && gc.size() > inicial + 1; intento++) {
+        ResultadoGC resultado = gc.runGCSlice(std::chrono::microseconds(1));
+        EXPECT_LE(resultado.objetosLiberados, resultado.objetosRevisados);
+        liberados += resultado.objetosLiberados;
+    }
+    EXPECT_EQ(liberados, 1000u);
+    EXPECT_EQ(gc.size(), inicial + 1);
+    EXPECT_EQ(viva.obtenerHead()->data, 1);
+}
+
+// Prueba para verificar que un tramo no depende del tamaño de la estructura
+// Qué sucede: Se recorre una lista viva de 200000 nodos con tramos de 500 us.
+// Por qué sucede: Toda la lista es una sola estructura conexa; la clausura de cada semilla se corta en
+// el objetivo del tramo y lo ya analizado en la vuelta no se vuelve a agregar.
+// Qué deberíamos esperar: Ningún tramo analiza la lista entera, una vuelta la analiza una sola vez y la
+// pausa máxima queda cerca del presupuesto. Después, runGC libera la lista soltada.
+TEST(GarbageCollectorTest, SliceBoundedOnLongListTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    std::size_t inicial = gc.size();
+    constexpr std::size_t NODOS = 200000;
+    const auto presupuesto = std::chrono::microseconds(500);
+    {
+        std::vector<int> valores(NODOS);
+        ListaDoble<int> lista(valores.begin(), valores.end());
+        for (int calentamiento = 0; calentamiento < 20; calentamiento++) {
+            gc.runGCSlice(presupuesto);  // Ajusta el costo por objeto estimado.
+        }
+        gc.resetPauseStats();
+        std::size_t revisados = 0;
+        std::size_t tramos = 0;
+        while (revisados < 2 * (inicial + NODOS) && tramos < 100000) {
+            ResultadoGC resultado = gc.runGCSlice(presupuesto);
+            EXPECT_LT(resultado.objetosRevisados, NODOS / 10);
+            EXPECT_EQ(resultado.objetosLiberados, 0u);
+            revisados += resultado.objetosRevisados;
+            tramos++;
+        }
+        EXPECT_GT(tramos, 10u);  // Dos vueltas, de a partes.
+        EXPECT_LT(gc.pauseStats().maxima, 10 * presupuesto);
+        EXPECT_EQ(lista.obtenerHead()->data, 0);
+    }
+    EXPECT_EQ(gc.runGC().objetosLiberados, NODOS);
+    EXPECT_EQ(gc.size(), inicial);
+}
+
+// Prueba para verificar el recolector en segundo plano
+// Qué sucede: Con el hilo activo, se crean y destruyen listas dentro de una SeccionMutador.
+// Por qué sucede: La presión de asignación supera `bytesParaActivar` y despierta al recolector.
+// Qué deberíamos esperar: Sin llamar a runGC, los ciclos se liberan y se registran las pausas.
+TEST(GarbageCollectorTest, BackgroundCollectorTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    gc.resetPauseStats();
+    std::size_t inicial = gc.size();
+
+    ConfiguracionGC config;
+    config.bytesParaActivar = 64u << 10;
+    config.intervalo = std::chrono::milliseconds(1);
+    gc.startBackgroundGC(config);
+    {
+        MPointerGC::SeccionMutador seccion;
+        for (int l = 0; l < 50; l++) {
+            ListaDoble<int> lista;
+            for (int i = 0; i < 100; i++) {
+                lista.agregar(i);
+            }
+        }
+    }
+    for (int espera = 0; espera < 2000 && gc.size() > inicial; espera++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    gc.stopBackgroundGC();
+    EXPECT_EQ(gc.size(), inicial);
+
+    EstadisticasPausas pausas = gc.pauseStats();
+    EXPECT_GT(pausas.cantidad, 0u);
+    EXPECT_LE(pausas.p50, pausas.p99);
+    EXPECT_LE(pausas.p99, pausas.maxima);
+}
+
+// Prueba para verificar que el recolector en segundo plano libera listas más grandes que un tramo
+// Qué sucede: Con la configuración por defecto se descarta una lista de 20000 nodos y después se
+// asignan objetos de vida corta hasta que el registro vuelve a su tamaño inicial.
+// Por qué sucede: Con 200 us por tramo ningún tramo cierra el ciclo de la lista; la vuelta que lo corta,
+// despertada por la presión de los temporales, escala a un runGC.
+// Qué deberíamos esperar: Sin llamar a runGC, la lista se libera.
+TEST(GarbageCollectorTest, BackgroundCollectorListaGrandeTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    std::size_t inicial = gc.size();
+
+    gc.startBackgroundGC();
+    {
+        MPointerGC::SeccionMutador seccion;
+        ListaDoble<int> lista;
+        for (int i = 0; i < 20000; i++) {
+            lista.agregar(i);
+        }
+    }
+    EXPECT_GE(gc.size(), inicial + 20000);
+    for (int ronda = 0; ronda < 5000 && gc.size() > inicial; ronda++) {
+        {
+            MPointerGC::SeccionMutador seccion;
+            for (int i = 0; i < 4096; i++) {
+                MPointer<int> temporal = MPointer<int>::New(i);  // Suma presión sin quedar en el registro.
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    gc.stopBackgroundGC();
+    EXPECT_EQ(gc.size(), inicial);
+}
+
+#ifndef NDEBUG
+// Prueba para verificar que el recolector en segundo plano exige una SeccionMutador
+// Qué sucede: Con el hilo activo, se crea y se copia un MPointer dentro y fuera de una sección.
+// Por qué sucede: Un cambio de contador fuera de una sección competiría con el análisis de un tramo.
+// Qué deberíamos esperar: Dentro de la sección todo funciona; fuera, el proceso termina en un assert.
+TEST(GarbageCollectorTest, SeccionMutadorObligatoriaTest) {
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.startBackgroundGC();
+    {
+        MPointerGC::SeccionMutador seccion;
+        MPointer<int> puntero = MPointer<int>::New(7);
+        MPointer<int> copia = puntero;
+        EXPECT_EQ(*copia, 7);
+    }
+    EXPECT_DEATH({ MPointer<int> fuera = MPointer<int>::New(7); }, "SeccionMutador");
+    gc.stopBackgroundGC();
+    MPointer<int> despues = MPointer<int>::New(7);  // Sin el recolector activo no hace falta la sección.
+    EXPECT_EQ(*despues, 7);
+}
+#endif
+
+// Tipos propios de las pruebas del perfil, para que ninguna otra prueba los registre
+struct ObjetoPerfilado {
+    double valores[4];
+};
+
+struct ObjetoMuestreado {
+    int valor;
+};
+
+static const PerfilTipo* buscarTipo(const PerfilHeap& perfil, const std::string& nombre) {
+    auto tipo = std::find_if(perfil.tipos.begin(), perfil.tipos.end(),
+                             [&](const PerfilTipo& candidato) { return candidato.tipo == nombre; });
+    return tipo == perfil.tipos.end() ? nullptr : &*tipo;
+}
+
+// Prueba del perfil del heap por tipo
+// Qué sucede: Se crean objetos de un mismo tipo en línea y adoptados con `new`, y se sueltan algunos.
+// Por qué sucede: Cada bloque lleva en sus operaciones el tipo y el tamaño del objeto.
+// Qué deberíamos esperar: Una sola fila para el tipo, con los vivos y los bytes de cada clase de bloque,
+// y las asignaciones contadas en la tasa.
+TEST(GarbageCollectorTest, HeapProfileTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    if (!gc.heapProfile().habilitado) {
+        GTEST_SKIP() << "Compilado con MPOINTERGC_SIN_PERFIL";
+    }
+    std::vector<MPointer<ObjetoPerfilado>> objetos;
+    for (int i = 0; i < 3; i++) {
+        objetos.push_back(MPointer<ObjetoPerfilado>::New());
+    }
+    objetos.emplace_back(new ObjetoPerfilado());
+    objetos.emplace_back(new ObjetoPerfilado());
+
+    PerfilHeap perfil = gc.heapProfile();
+    const PerfilTipo* tipo = buscarTipo(perfil, "ObjetoPerfilado");
+    ASSERT_NE(tipo, nullptr);
+    EXPECT_EQ(tipo->objetosVivos, 5u);
+    EXPECT_EQ(tipo->bytesVivos, 3 * sizeof(BloqueEnLinea<ObjetoPerfilado>)
+                                    + 2 * (sizeof(BloqueExterno<ObjetoPerfilado>) + sizeof(ObjetoPerfilado)));
+    EXPECT_GE(perfil.asignaciones, 5u);
+
+    objetos.erase(objetos.begin(), objetos.begin() + 3);
+    tipo = buscarTipo(perfil = gc.heapProfile(), "ObjetoPerfilado");
+    ASSERT_NE(tipo, nullptr);
+    EXPECT_EQ(tipo->objetosVivos, 2u);
+    EXPECT_EQ(tipo->bytesVivos, 2 * (sizeof(BloqueExterno<ObjetoPerfilado>) + sizeof(ObjetoPerfilado)));
+
+    objetos.clear();
+    EXPECT_EQ(buscarTipo(gc.heapProfile(), "ObjetoPerfilado"), nullptr);  // Sin vivos, el tipo no aparece.
+}
+
+// Prueba de los formatos del perfil con muestreo
+// Qué sucede: Se muestrean todos los registros, se crea un objeto y se vuelca el perfil en los dos formatos.
+// Por qué sucede: Las muestras guardan la pila de llamadas del registro.
+// Qué deberíamos esperar: El tipo y un sitio con su pila en JSON, y las métricas del tipo en Prometheus.
+TEST(GarbageCollectorTest, HeapProfileFormatsTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    if (!gc.heapProfile().habilitado) {
+        GTEST_SKIP() << "Compilado con MPOINTERGC_SIN_PERFIL";
+    }
+    gc.setAllocationSampling(1);
+    MPointer<ObjetoMuestreado> objeto = MPointer<ObjetoMuestreado>::New();
+    gc.setAllocationSampling(0);
+
+    PerfilHeap perfil = gc.heapProfile();
+    auto sitio = std::find_if(perfil.sitios.begin(), perfil.sitios.end(),
+                              [](const SitioAsignacion& candidato) { return candidato.tipo == "ObjetoMuestreado"; });
+    ASSERT_NE(sitio, perfil.sitios.end());
+    EXPECT_EQ(sitio->muestras, 1u);
+    EXPECT_FALSE(sitio->marcos.empty());
+
+    std::ostringstream json;
+    gc.dumpHeapProfile(json, FormatoPerfil::Json);
+    EXPECT_EQ(json.str().front(), '{');
+    EXPECT_NE(json.str().find("{\"tipo\":\"ObjetoMuestreado\",\"objetosVivos\":1,"), std::string::npos);
+    EXPECT_NE(json.str().find("\"marcos\":[\""), std::string::npos);
+
+    std::ostringstream prometheus;
+    gc.dumpHeapProfile(prometheus, FormatoPerfil::Prometheus);
+    EXPECT_NE(prometheus.str().find("# TYPE mpointer_objetos_vivos gauge\n"), std::string::npos);
+    EXPECT_NE(prometheus.str().find("mpointer_objetos_vivos{tipo=\"ObjetoMuestreado\"} 1\n"), std::string::npos);
+    EXPECT_NE(prometheus.str().find("mpointer_muestras_asignacion_total{tipo=\"ObjetoMuestreado\",pila="),
+              std::string::npos);
+}
+
+// Prueba del modo generacional con temporales
+// Qué sucede: Con el modo generacional, se crean y destruyen cien mil MPointer<int> de a uno.
+// Por qué sucede: Cada uno nace en la guardería del hilo y muere por su contador antes de cualquier
+// recolección, así que su espacio se reutiliza sin pasar por el registro.
+// Qué deberíamos esperar: El registro no cambia, las asignaciones jóvenes suben en cien mil y la
+// guardería crece a lo sumo en un trozo.
+TEST(GarbageCollectorTest, GenerationalShortLivedTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    gc.setGenerationalMode(true);
+    std::size_t inicial = gc.size();
+    EstadisticasGC antes = gc.stats();
+    for (int i = 0; i < 100000; i++) {
+        MPointer<int> temporal = MPointer<int>::New(i);
+        EXPECT_EQ(temporal.getId(), MPointerGC::HANDLE_INVALIDO);
+        EXPECT_EQ(*temporal, i);
+    }
+    EstadisticasGC despues = gc.stats();
+    gc.setGenerationalMode(false);
+
+    EXPECT_EQ(gc.size(), inicial);
+    EXPECT_EQ(despues.asignacionesJovenes - antes.asignacionesJovenes, 100000u);
+    EXPECT_EQ(despues.bytesAsignadosJovenes - antes.bytesAsignadosJovenes, 100000u * Guarderia::redondear(sizeof(BloqueEnLinea<int>)));
+    EXPECT_EQ(despues.asignacionesTotales, antes.asignacionesTotales);
+    EXPECT_LE(despues.bytesGuarderia - antes.bytesGuarderia, Guarderia::BYTES_TROZO);
+}
+
+// Prueba de la recolección menor y la promoción
+// Qué sucede: Con el modo generacional, se mantienen vivos diez objetos jóvenes, se deja un ciclo
+// de dos nodos jóvenes inalcanzable y se ejecuta runMinorGC; después, runGC.
+// Por qué sucede: La recolección menor analiza solo los jóvenes: libera su ciclo y registra a los
+// sobrevivientes, que desde entonces son objetos comunes del registro.
+// Qué deberíamos esperar: Dos liberados y diez promovidos, con handle y registrados; la referencia
+// débil al ciclo vencida; el runGC siguiente no promueve nada y soltar a los promovidos los desregistra.
+TEST(GarbageCollectorTest, GenerationalPromotionTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    std::size_t inicial = gc.size();
+    std::uint64_t promovidosAntes = gc.stats().promovidos;
+    gc.setGenerationalMode(true);
+
+    std::vector<MPointer<int>> sobrevivientes;
+    for (int i = 0; i < 10; i++) {
+        sobrevivientes.push_back(MPointer<int>::New(i));
+    }
+    MWeakPointer<Nodo<int>> ciclo;
+    {
+        MPointer<Nodo<int>> a = MPointer<Nodo<int>>::New(1);
+        MPointer<Nodo<int>> b = MPointer<Nodo<int>>::New(2);
+        a->siguiente = b;
+        b->anterior = a;
+        ciclo = a;
+    }
+    EXPECT_EQ(gc.size(), inicial);
+
+    ResultadoGC menor = gc.runMinorGC();
+    gc.setGenerationalMode(false);
+    EXPECT_EQ(menor.objetosLiberados, 2u);
+    EXPECT_EQ(menor.objetosPromovidos, 10u);
+    EXPECT_TRUE(ciclo.expired());
+    EXPECT_EQ(gc.size(), inicial + 10);
+    for (int i = 0; i < 10; i++) {
+        EXPECT_TRUE(gc.isRegistered(sobrevivientes[i].getId()));
+        EXPECT_EQ(*sobrevivientes[i], i);
+    }
+    EstadisticasGC estadisticas = gc.stats();
+    EXPECT_EQ(estadisticas.promovidos - promovidosAntes, 10u);
+    EXPECT_GT(estadisticas.supervivencia, 0.0);
+    EXPECT_LE(estadisticas.supervivencia, 1.0);
+    EXPECT_GT(estadisticas.asignacionesPorSegundo, 0.0);
+
+    EXPECT_EQ(gc.runGC().objetosPromovidos, 0u);
+    MPointerGC::Handle primero = sobrevivientes[0].getId();
+    sobrevivientes.clear();
+    EXPECT_FALSE(gc.isRegistered(primero));
+    EXPECT_EQ(gc.size(), inicial);
+}
+
+// Prueba de la guardería entre hilos
+// Qué sucede: Un hilo crea mil objetos jóvenes y termina; el hilo principal los suelta y otro hilo crea
+// otros mil.
+// Por qué sucede: El hilo que termina retira su trozo, y el último objeto que se suelta lo devuelve
+// a la reserva común.
+// Qué deberíamos esperar: El segundo hilo reutiliza ese trozo: la guardería no crece.
+TEST(GarbageCollectorTest, GenerationalCrossThreadTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.setGenerationalMode(true);
+    std::vector<MPointer<int>> creados;
+    std::thread([&creados] {
+        for (int i = 0; i < 1000; i++) {
+            creados.push_back(MPointer<int>::New(i));
+        }
+    }).join();
+    EXPECT_EQ(creados[999].getId(), MPointerGC::HANDLE_INVALIDO);
+    creados.clear();
+    std::uint64_t bytesGuarderia = gc.stats().bytesGuarderia;
+
+    std::thread([] {
+        for (int i = 0; i < 1000; i++) {
+            MPointer<int> temporal = MPointer<int>::New(i);
+        }
+    }).join();
+    gc.setGenerationalMode(false);
+    EXPECT_EQ(gc.stats().bytesGuarderia, bytesGuarderia);
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "InstantaneaLista.h"
+
+// Ruta de un archivo temporal para cada prueba
+static std::string rutaTemporal(const std::string& nombre) {
+    return ::testing::TempDir() + "instantanea_" + nombre;
+}
+
+// Prueba de una instantánea plana
+// Qué sucede: Se guarda una lista de enteros, se lee mapeada y se carga en otra lista.
+// Por qué sucede: Con T trivialmente copiable los valores forman un arreglo que se lee en el lugar.
+// Qué deberíamos esperar: Los mismos valores en el mismo orden, por los dos caminos.
+TEST(InstantaneaTest, PlanaTest) {
+    const std::string ruta = rutaTemporal("plana");
+    std::vector<int> valores(10000);
+    std::iota(valores.begin(), valores.end(), -5000);
+    ListaDoble<int> original(valores.begin(), valores.end());
+    guardarInstantanea(original, ruta);
+
+    InstantaneaMapeada<int> mapeada(ruta);
+    EXPECT_EQ(mapeada.tamano(), valores.size());
+    EXPECT_TRUE(std::equal(mapeada.begin(), mapeada.end(), valores.begin(), valores.end()));
+
+    ListaDoble<int, PoliticaIntrusiva> cargada;
+    cargarInstantanea(ruta, cargada);
+    EXPECT_TRUE(std::equal(cargada.begin(), cargada.end(), valores.begin(), valores.end()));
+    std::remove(ruta.c_str());
+}
+
+// Prueba de independencia de la posición
+// Qué sucede: Se copian los bytes de una instantánea a otro archivo y se mapean los dos a la vez.
+// Por qué sucede: El formato guarda desplazamientos, no punteros, así que no depende de dónde se mapee.
+// Qué deberíamos esperar: Los dos mapeos, en direcciones distintas, leen los mismos valores.
+TEST(InstantaneaTest, IndependienteDeLaPosicionTest) {
+    const std::string ruta = rutaTemporal("origen");
+    const std::string copia = rutaTemporal("copia");
+    std::vector<double> valores{1.5, -2.25, 3.0};
+    guardarInstantanea(valores.data(), valores.data() + valores.size(), ruta);
+    {
+        std::ifstream entrada(ruta, std::ios::binary);
+        std::ofstream salida(copia, std::ios::binary);
+        salida << entrada.rdbuf();
+    }
+    InstantaneaMapeada<double> primera(ruta);
+    InstantaneaMapeada<double> segunda(copia);
+    EXPECT_NE(primera.begin(), segunda.begin());
+    EXPECT_TRUE(std::equal(primera.begin(), primera.end(), segunda.begin(), segunda.end()));
+    EXPECT_EQ(segunda[1], -2.25);
+    std::remove(ruta.c_str());
+    std::remove(copia.c_str());
+}
+
+// Prueba de una instantánea de registros
+// Qué sucede: Se guarda una lista de cadenas (incluida una vacía y una más grande que el búfer) y se
+// carga al final de una lista que ya tiene valores.
+// Por qué sucede: Las cadenas no son trivialmente copiables: se escriben con SerializacionInstantanea.
+// Qué deberíamos esperar: Los valores previos y después los cargados, en orden.
+TEST(InstantaneaTest, RegistrosTest) {
+    const std::string ruta = rutaTemporal("registros");
+    ListaDoble<std::string> original{"uno", "", std::string(LectorInstantanea::BYTES_BUFER + 10, 'x'), "cuatro"};
+    for (int i = 0; i < 5000; i++) {
+        original.agregar(std::to_string(i));
+    }
+    guardarInstantanea(original, ruta);
+
+    ListaDoble<std::string> cargada{"previo"};
+    cargarInstantanea(ruta, cargada);
+    auto actual = cargada.begin();
+    EXPECT_EQ(*actual++, "previo");
+    EXPECT_TRUE(std::equal(actual, cargada.end(), original.begin(), original.end()));
+    std::remove(ruta.c_str());
+}
+
+// Prueba de archivos inválidos
+// Qué sucede: Se leen una instantánea de otro tipo, una truncada y un archivo que no es instantánea.
+// Por qué sucede: La cabecera describe el tipo y el tamaño de los datos.
+// Qué deberíamos esperar: Todos los casos lanzan std::runtime_error en vez de leer memoria inválida.
+TEST(InstantaneaTest, ArchivoInvalidoTest) {
+    const std::string ruta = rutaTemporal("invalida");
+    ListaDoble<int> lista{1, 2, 3};
+    guardarInstantanea(lista, ruta);
+    EXPECT_THROW(InstantaneaMapeada<long long>{ruta}, std::runtime_error);
+
+    ListaDoble<std::string> cadenas;
+    EXPECT_THROW(cargarInstantanea(ruta, cadenas), std::runtime_error);
+
+    {
+        std::ofstream salida(ruta, std::ios::binary | std::ios::app);
+        salida << "basura";
+    }
+    EXPECT_NO_THROW(InstantaneaMapeada<int>{ruta});  // Bytes de más después de los datos se ignoran.
+
+    {
+        std::ofstream salida(ruta, std::ios::binary | std::ios::trunc);
+        salida << std::string(sizeof(CabeceraInstantanea), 'z');
+    }
+    EXPECT_THROW(InstantaneaMapeada<int>{ruta}, std::runtime_error);
+    EXPECT_THROW(InstantaneaMapeada<int>{rutaTemporal("inexistente")}, std::system_error);
+    std::remove(ruta.c_str());
+}
+
+// Iterador de enteros que lanza al llegar a `falla`, para cortar una escritura a la mitad
+struct IteradorQueFalla {
+    using iterator_category = std::input_iterator_tag;
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const int*;
+    using reference = int;
+
+    int actual;
+    int falla;
+
+    int operator*() const {
+        if (actual == falla) {
+            throw std::runtime_error("Corte de prueba");
+        }
+        return actual;
+    }
+
+    IteradorQueFalla& operator++() {
+        ++actual;
+        return *this;
+    }
+
+    bool operator==(const IteradorQueFalla& otro) const {
+        return actual == otro.actual;
+    }
+
+    bool operator!=(const IteradorQueFalla& otro) const {
+        return actual != otro.actual;
+    }
+};
+
+// Prueba de una escritura que falla a la mitad
+// Qué sucede: Sobre una instantánea existente se guarda un rango cuyo iterador lanza a la mitad.
+// Por qué sucede: La escritura va a `ruta`.tmp, que solo se renombra si se completó.
+// Qué deberíamos esperar: La excepción llega al llamador, la instantánea anterior queda intacta y no
+// queda ningún temporal.
+TEST(InstantaneaTest, EscrituraInterrumpidaTest) {
+    const std::string ruta = rutaTemporal("interrumpida");
+    ListaDoble<int> lista{1, 2, 3};
+    guardarInstantanea(lista, ruta);
+
+    EXPECT_THROW(guardarInstantanea(IteradorQueFalla{0, 500}, IteradorQueFalla{1000, 500}, ruta), std::runtime_error);
+    InstantaneaMapeada<int> mapeada(ruta);
+    std::vector<int> esperado{1, 2, 3};
+    EXPECT_TRUE(std::equal(mapeada.begin(), mapeada.end(), esperado.begin(), esperado.end()));
+    EXPECT_FALSE(std::ifstream(ruta + ".tmp").good());
+    std::remove(ruta.c_str());
+}
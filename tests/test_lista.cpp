@@ -1,4 +1,18 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#ifdef MPOINTER_CON_TBB
+#include <execution>
+#endif
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ListaDesenrollada.h"
 #include "ListaDoble.h"
 #include "sorting.h"
 
@@ -59,3 +73,854 @@ TEST(ListaDobleTest, InsertionSortTest) {
     EXPECT_EQ(lista.obtenerHead()->siguiente->data, 3);  // El segundo elemento debe ser 3.
     EXPECT_EQ(lista.obtenerTail()->data, 4);  // El último elemento debe ser 4.
 }
+
+// Prueba para verificar que recorrer y ordenar no cambia los contadores de referencias
+// Qué sucede: Se crea una lista de tres nodos, se ordena y se imprime.
+// Por qué sucede: Esta prueba asegura que los recorridos usan vistas y no copian MPointers.
+// Qué deberíamos esperar: Cada nodo conserva sus dos referencias (enlace de la lista y enlace del vecino).
+TEST(ListaDobleTest, TraversalKeepsRefCountsTest) {
+    ListaDoble<int> lista;
+    lista.agregar(2);
+    lista.agregar(3);
+    lista.agregar(1);
+
+    const MPointer<Nodo<int>>& medio = lista.obtenerHead()->siguiente;
+    EXPECT_EQ(lista.obtenerHead().useCount(), 2);  // `head` y el `anterior` del segundo nodo.
+    EXPECT_EQ(medio.useCount(), 2);  // `siguiente` del primero y `anterior` del tercero.
+    EXPECT_EQ(lista.obtenerTail().useCount(), 2);  // `tail` y el `siguiente` del segundo nodo.
+
+    quickSort(lista.obtenerHead(), lista.obtenerTail());
+    lista.imprimir();
+
+    EXPECT_EQ(lista.obtenerHead().useCount(), 2);
+    EXPECT_EQ(medio.useCount(), 2);
+    EXPECT_EQ(lista.obtenerTail().useCount(), 2);
+    EXPECT_EQ(lista.obtenerHead()->data, 1);
+    EXPECT_EQ(medio->data, 2);
+}
+
+// Prueba para verificar que los nodos de una lista con arena propia quedan contiguos
+// Qué sucede: Se agregan nodos a una lista que reserva en su propia ArenaDe y se miden sus direcciones.
+// Por qué sucede: La arena reparte los bloques en orden dentro de cada losa.
+// Qué deberíamos esperar: Cada nodo está a un bloque de distancia del anterior (salvo al cambiar de losa),
+// y el GC devuelve los nodos a la arena antes de que se destruya.
+TEST(ListaDobleTest, ArenaKeepsNodesContiguousTest) {
+    MPointerGC::getInstance().runGC();  // Parte sin basura de otras pruebas.
+    ArenaDe<Nodo<int>> arena;
+    {
+        ListaDoble<int> lista(&arena);
+        for (int i = 0; i < 100; i++) {
+            lista.agregar(i);
+        }
+        int contiguos = 0;
+        MPointerVista<Nodo<int>> actual = lista.obtenerHead();
+        while (actual->siguiente != nullptr) {
+            MPointerVista<Nodo<int>> siguiente = actual->siguiente;
+            std::ptrdiff_t distancia = reinterpret_cast<char*>(siguiente.get()) - reinterpret_cast<char*>(actual.get());
+            if (distancia == static_cast<std::ptrdiff_t>(sizeof(BloqueEnLinea<Nodo<int>>))) {
+                contiguos++;
+            }
+            actual = siguiente;
+        }
+        EXPECT_GE(contiguos, 95);  // 100 nodos ocupan a lo sumo dos losas.
+    }
+    EXPECT_EQ(MPointerGC::getInstance().runGC().objetosLiberados, 100u);
+}
+
+// Valor con clave repetible y posición de origen, para comprobar la estabilidad
+struct RegistroOrden {
+    int clave;
+    int orden;
+
+    bool operator<(const RegistroOrden& otro) const {
+        return clave < otro.clave;
+    }
+};
+
+// Prueba para verificar MergeSort
+// Qué sucede: Se ordena una lista desordenada y se recorren los enlaces en ambos sentidos.
+// Por qué sucede: MergeSort reenlaza los nodos, así que debe reconstruir `anterior`, `head` y `tail`.
+// Qué deberíamos esperar: Valores ascendentes, enlaces coherentes y dos referencias por nodo, como antes.
+TEST(ListaDobleTest, MergeSortTest) {
+    ListaDoble<int> lista;
+    int valores[] = {5, 3, 8, 1, 9, 2, 7, 3, 6, 4};
+    for (int valor : valores) {
+        lista.agregar(valor);
+    }
+    lista.ordenarMerge();
+
+    int esperados[] = {1, 2, 3, 3, 4, 5, 6, 7, 8, 9};
+    MPointerVista<Nodo<int>> actual = lista.obtenerHead();
+    EXPECT_EQ(lista.obtenerHead()->anterior, nullptr);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_NE(actual, nullptr);
+        EXPECT_EQ(actual->data, esperados[i]);
+        if (actual->siguiente != nullptr) {
+            EXPECT_EQ(MPointerVista<Nodo<int>>(actual->siguiente->anterior), actual);
+        }
+        EXPECT_EQ(MPointer<Nodo<int>>(actual).useCount(), 3);  // Sus dos enlaces más esta copia.
+        actual = actual->siguiente;
+    }
+    EXPECT_EQ(actual, nullptr);
+    EXPECT_EQ(lista.obtenerTail()->data, 9);
+    EXPECT_EQ(lista.obtenerTail()->siguiente, nullptr);
+
+    ListaDoble<int> vacia;
+    vacia.ordenarMerge();
+    EXPECT_EQ(vacia.obtenerHead(), nullptr);
+    EXPECT_EQ(vacia.obtenerTail(), nullptr);
+}
+
+// Prueba para verificar que MergeSort es estable y no usa recursión
+// Qué sucede: Se ordena una lista grande, ya ordenada en sentido inverso, con muchas claves repetidas.
+// Por qué sucede: Con entradas así QuickSort recurre n niveles; MergeSort no recurre.
+// Qué deberíamos esperar: Entre claves iguales se conserva el orden de inserción.
+TEST(ListaDobleTest, MergeSortStableTest) {
+    MPointerGC::getInstance().runGC();
+    {
+        ListaDoble<RegistroOrden> lista;
+        const int n = 200000;
+        for (int i = 0; i < n; i++) {
+            lista.agregar({(n - i) / 10, i});
+        }
+        lista.ordenarMerge();
+
+        MPointerVista<Nodo<RegistroOrden>> actual = lista.obtenerHead();
+        int contados = 1;
+        bool ordenada = true;
+        while (actual->siguiente != nullptr) {
+            const RegistroOrden& a = actual->data;
+            const RegistroOrden& b = actual->siguiente->data;
+            ordenada = ordenada && (a.clave < b.clave || (a.clave == b.clave && a.orden < b.orden));
+            actual = actual->siguiente;
+            contados++;
+        }
+        EXPECT_TRUE(ordenada);
+        EXPECT_EQ(contados, n);
+        EXPECT_EQ(MPointerVista<Nodo<RegistroOrden>>(lista.obtenerTail()), actual);
+    }
+    EXPECT_EQ(MPointerGC::getInstance().runGC().objetosLiberados, 200000u);
+}
+
+// Prueba para verificar MergeSort paralelo
+// Qué sucede: Se ordena en un pool de cuatro hilos una lista con claves repetidas, con un corte bajo
+// para que se divida en varios tramos, y una lista corta que se ordena en serie.
+// Por qué sucede: Los tramos se ordenan y mezclan en paralelo, pero el resultado debe ser el mismo que en serie.
+// Qué deberíamos esperar: Orden estable, enlaces `anterior` coherentes y `tail` en el último nodo.
+TEST(ListaDobleTest, ParallelSortTest) {
+    MPointerGC::getInstance().runGC();
+    PoolTareas pool(4);
+    {
+        ListaDoble<RegistroOrden> lista;
+        const int n = 50000;
+        for (int i = 0; i < n; i++) {
+            lista.agregar({(i * 7919) % 1000, i});
+        }
+        lista.ordenarParalelo(pool, 1000);
+
+        MPointerVista<Nodo<RegistroOrden>> actual = lista.obtenerHead();
+        EXPECT_EQ(actual->anterior, nullptr);
+        int contados = 1;
+        bool ordenada = true;
+        bool enlazada = true;
+        while (actual->siguiente != nullptr) {
+            const RegistroOrden& a = actual->data;
+            const RegistroOrden& b = actual->siguiente->data;
+            ordenada = ordenada && (a.clave < b.clave || (a.clave == b.clave && a.orden < b.orden));
+            enlazada = enlazada && MPointerVista<Nodo<RegistroOrden>>(actual->siguiente->anterior) == actual;
+            actual = actual->siguiente;
+            contados++;
+        }
+        EXPECT_TRUE(ordenada);
+        EXPECT_TRUE(enlazada);
+        EXPECT_EQ(contados, n);
+        EXPECT_EQ(MPointerVista<Nodo<RegistroOrden>>(lista.obtenerTail()), actual);
+
+        ListaDoble<int> corta;
+        corta.agregar(3);
+        corta.agregar(1);
+        corta.agregar(2);
+        corta.ordenarParalelo(pool);
+        EXPECT_EQ(corta.obtenerHead()->data, 1);
+        EXPECT_EQ(corta.obtenerTail()->data, 3);
+    }
+    EXPECT_EQ(MPointerGC::getInstance().runGC().objetosLiberados, 50003u);
+}
+
+// Prueba para verificar la lista con nodos intrusivos
+// Qué sucede: Se llena una lista con PoliticaIntrusiva, se ordena con QuickSort y con MergeSort y se abandona.
+// Por qué sucede: El contador vive en el nodo, así que cada enlace es un solo puntero y el nodo ocupa
+// menos que un BloqueEnLinea de un nodo normal; el GC debe seguir encontrando sus ciclos.
+// Qué deberíamos esperar: Ambos ordenamientos dan el mismo resultado y el GC libera todos los nodos.
+TEST(ListaDobleTest, NodosIntrusivosTest) {
+    static_assert(sizeof(EnlaceNodo<int, PoliticaIntrusiva>) == sizeof(void*), "Un enlace es un puntero");
+    static_assert(sizeof(Nodo<int, PoliticaIntrusiva>) < sizeof(BloqueEnLinea<Nodo<int>>), "Nodo más chico");
+
+    MPointerGC::getInstance().runGC();  // Descarta la basura de otras pruebas.
+    {
+        ListaDoble<int, PoliticaIntrusiva> lista;
+        for (int i = 0; i < 1000; i++) {
+            lista.agregar((i * 7919) % 1000);
+        }
+        quickSort(lista.obtenerHead(), lista.obtenerTail());
+        int esperado = 0;
+        for (VistaNodo<int, PoliticaIntrusiva> actual = lista.obtenerHead(); actual != nullptr; actual = actual->siguiente) {
+            EXPECT_EQ(actual->data, esperado++);
+        }
+
+        lista.agregar(-1);
+        lista.ordenarMerge();
+        EXPECT_EQ(lista.obtenerHead()->data, -1);
+        EXPECT_EQ(lista.obtenerTail()->data, 999);
+        EXPECT_EQ(lista.obtenerTail()->anterior->data, 998);
+        EXPECT_EQ(lista.obtenerHead()->siguiente.useCount(), 2);  // Enlaces desde sus dos vecinos.
+    }
+    ResultadoGC resultado = MPointerGC::getInstance().runGC();
+    EXPECT_EQ(resultado.objetosLiberados, 1001u);
+    EXPECT_EQ(resultado.bytesLiberados, 1001 * sizeof(Nodo<int, PoliticaIntrusiva>));
+}
+
+// Prueba para verificar los iteradores de la lista desenrollada
+// Qué sucede: Se agregan 20 elementos a una lista de 8 por nodo y se recorre hacia adelante y hacia atrás.
+// Por qué sucede: Los iteradores deben cruzar los bordes entre nodos y funcionar con <algorithm>.
+// Qué deberíamos esperar: Tres nodos (8, 8 y 4 elementos) y los valores en orden en ambos sentidos.
+TEST(ListaDesenrolladaTest, IteradoresTest) {
+    ListaDesenrollada<int, 8> lista;
+    EXPECT_TRUE(lista.begin() == lista.end());
+    for (int i = 0; i < 20; i++) {
+        lista.agregar(i);
+    }
+    EXPECT_EQ(lista.tamano(), 20u);
+    EXPECT_EQ(lista.obtenerHead()->cantidad, 8u);
+    EXPECT_EQ(lista.obtenerTail()->cantidad, 4u);
+    EXPECT_EQ(lista.obtenerHead()->siguiente->siguiente, lista.obtenerTail());
+
+    std::vector<int> adelante(lista.begin(), lista.end());
+    std::vector<int> atras(lista.rbegin(), lista.rend());
+    std::vector<int> esperado(20);
+    std::iota(esperado.begin(), esperado.end(), 0);
+    EXPECT_EQ(adelante, esperado);
+    std::reverse(esperado.begin(), esperado.end());
+    EXPECT_EQ(atras, esperado);
+
+    const ListaDesenrollada<int, 8>& constante = lista;
+    EXPECT_EQ(std::accumulate(constante.begin(), constante.end(), 0), 190);
+    EXPECT_EQ(*std::find(lista.begin(), lista.end(), 12), 12);
+    EXPECT_EQ(std::distance(lista.begin(), lista.end()), 20);
+}
+
+// Prueba de los iteradores de la lista desenrollada a través de `agregar`
+// Qué sucede: Con el último nodo lleno, se toman un iterador al último elemento y end(), y se agrega
+// un valor, que crea un nodo nuevo.
+// Por qué sucede: El final era la posición siguiente al último elemento del nodo lleno, que ahora
+// tiene un siguiente.
+// Qué deberíamos esperar: El end() anterior designa el valor agregado y avanzar desde el último
+// elemento llega a él y después al end() nuevo.
+TEST(ListaDesenrolladaTest, IteradoresTrasAgregarTest) {
+    ListaDesenrollada<int, 4> lista;
+    for (int i = 0; i < 4; i++) {
+        lista.agregar(i);
+    }
+    ListaDesenrollada<int, 4>::iterator ultimo = std::prev(lista.end());
+    ListaDesenrollada<int, 4>::iterator finalAnterior = lista.end();
+    lista.agregar(4);
+
+    EXPECT_EQ(*ultimo, 3);
+    EXPECT_TRUE(finalAnterior != lista.end());
+    EXPECT_EQ(*finalAnterior, 4);
+    ++ultimo;
+    EXPECT_TRUE(ultimo == finalAnterior);
+    EXPECT_EQ(*ultimo, 4);
+    ++ultimo;
+    EXPECT_TRUE(ultimo == lista.end());
+    ++finalAnterior;
+    EXPECT_TRUE(finalAnterior == lista.end());
+    EXPECT_EQ(std::distance(lista.begin(), lista.end()), 5);
+
+    // En un nodo con lugar, el final anterior pasa a ser el valor agregado sin cambiar de nodo.
+    const ListaDesenrollada<int, 4>& constante = lista;
+    ListaDesenrollada<int, 4>::const_iterator otroFinal = constante.end();
+    lista.agregar(5);
+    EXPECT_EQ(*otroFinal, 5);
+    EXPECT_EQ(std::distance(otroFinal, constante.end()), 1);
+}
+
+// Prueba para verificar los ordenamientos sobre la lista desenrollada
+// Qué sucede: Se ordena la misma entrada aleatoria con los cuatro algoritmos de sorting.h.
+// Por qué sucede: Las sobrecargas para ListaDesenrollada recorren los nodos con iteradores.
+// Qué deberíamos esperar: Todos dan el resultado de std::sort, incluso con un nodo incompleto.
+TEST(ListaDesenrolladaTest, OrdenamientosTest) {
+    std::mt19937 generador(3);
+    std::vector<int> valores(1000);
+    for (int& valor : valores) {
+        valor = static_cast<int>(generador() % 100);
+    }
+    std::vector<int> esperado = valores;
+    std::sort(esperado.begin(), esperado.end());
+
+    auto ordenarCon = [&valores](void (*ordenar)(ListaDesenrollada<int, 16>&)) {
+        ListaDesenrollada<int, 16> lista;
+        for (int valor : valores) {
+            lista.agregar(valor);
+        }
+        ordenar(lista);
+        return std::vector<int>(lista.begin(), lista.end());
+    };
+    EXPECT_EQ(ordenarCon(&quickSort<int, 16>), esperado);
+    EXPECT_EQ(ordenarCon(&mergeSort<int, 16>), esperado);
+    EXPECT_EQ(ordenarCon(&bubbleSort<int, 16>), esperado);
+    EXPECT_EQ(ordenarCon(&insertionSort<int, 16>), esperado);
+
+    ListaDesenrollada<int, 16> ordenada;  // Entrada ya ordenada: el peor caso de QuickSort.
+    for (int i = 0; i < 5000; i++) {
+        ordenada.agregar(i);
+    }
+    quickSort(ordenada);
+    EXPECT_TRUE(std::is_sorted(ordenada.begin(), ordenada.end()));
+}
+
+// Prueba para verificar la estabilidad y la liberación de la lista desenrollada
+// Qué sucede: Se ordenan registros con claves repetidas con `ordenarMerge` y se abandona la lista.
+// Por qué sucede: MergeSort conserva el orden de los iguales; los nodos forman ciclos que libera el GC.
+// Qué deberíamos esperar: Orden estable y un objeto liberado por nodo, con los elementos destruidos.
+TEST(ListaDesenrolladaTest, MergeSortEstableTest) {
+    MPointerGC::getInstance().runGC();  // Descarta la basura de otras pruebas.
+    {
+        ListaDesenrollada<RegistroOrden> lista;
+        for (int i = 0; i < 5000; i++) {
+            lista.agregar(RegistroOrden{(i * 7) % 10, i});
+        }
+        lista.ordenarMerge();
+        EXPECT_TRUE(std::is_sorted(lista.begin(), lista.end(), [](const RegistroOrden& a, const RegistroOrden& b) {
+            return a.clave < b.clave || (a.clave == b.clave && a.orden < b.orden);
+        }));
+    }
+    std::size_t nodos = (5000 + capacidadDesenrollada<RegistroOrden>() - 1) / capacidadDesenrollada<RegistroOrden>();
+    EXPECT_EQ(MPointerGC::getInstance().runGC().objetosLiberados, nodos);
+}
+
+// Prueba para verificar los iteradores de ListaDoble
+// Qué sucede: Se recorre la lista con range-for, con iteradores inversos y con algoritmos de <algorithm>.
+// Por qué sucede: Los iteradores son punteros crudos a los nodos y no copian ningún MPointer.
+// Qué deberíamos esperar: Los valores en orden en ambos sentidos, sin cambios en los contadores ni en el GC.
+TEST(ListaDobleTest, IteradoresTest) {
+    ListaDoble<int> lista;
+    EXPECT_TRUE(lista.begin() == lista.end());
+    for (int i = 1; i <= 10; i++) {
+        lista.agregar(i);
+    }
+    int referenciasHead = lista.obtenerHead().useCount();
+    EstadisticasGC antes = MPointerGC::getInstance().stats();
+
+    int suma = 0;
+    for (int valor : lista) {
+        suma += valor;
+    }
+    EXPECT_EQ(suma, 55);
+    EXPECT_EQ(std::vector<int>(lista.rbegin(), lista.rend()), (std::vector<int>{10, 9, 8, 7, 6, 5, 4, 3, 2, 1}));
+    EXPECT_EQ(*std::prev(lista.end()), 10);  // Desde el final se retrocede al `tail`.
+
+    std::reverse(lista.begin(), lista.end());  // Intercambia valores, no nodos.
+    EXPECT_EQ(lista.obtenerHead()->data, 10);
+    EXPECT_TRUE(std::is_sorted(lista.rbegin(), lista.rend()));
+    const ListaDoble<int>& constante = lista;
+    EXPECT_EQ(*std::find(constante.begin(), constante.end(), 4), 4);
+    EXPECT_EQ(std::distance(constante.begin(), constante.end()), 10);
+
+    EXPECT_EQ(lista.obtenerHead().useCount(), referenciasHead);
+    EstadisticasGC despues = MPointerGC::getInstance().stats();
+    EXPECT_EQ(despues.asignacionesTotales, antes.asignacionesTotales);
+    EXPECT_EQ(despues.liberacionesTotales, antes.liberacionesTotales);
+}
+
+// Prueba para verificar los iteradores con nodos intrusivos y políticas de ejecución
+// Qué sucede: Se transforma una lista intrusiva con std::for_each, en paralelo si hay backend (TBB).
+// Por qué sucede: Los algoritmos paralelos aceptan iteradores bidireccionales; cada nodo se toca una vez.
+// Qué deberíamos esperar: Todos los valores duplicados y la suma correcta.
+TEST(ListaDobleTest, IteradoresConPoliticaTest) {
+    ListaDoble<int, PoliticaIntrusiva> lista;
+    for (int i = 0; i < 10000; i++) {
+        lista.agregar(i);
+    }
+    auto duplicar = [](int& valor) { valor *= 2; };
+#ifdef MPOINTER_CON_TBB
+    std::for_each(std::execution::par, lista.begin(), lista.end(), duplicar);
+    long long suma = std::reduce(std::execution::par, lista.begin(), lista.end(), 0LL);
+#else
+    std::for_each(lista.begin(), lista.end(), duplicar);
+    long long suma = std::accumulate(lista.begin(), lista.end(), 0LL);
+#endif
+    EXPECT_EQ(suma, 2LL * 9999 * 10000 / 2);
+    EXPECT_EQ(lista.obtenerTail()->data, 19998);
+}
+
+// Prueba de construcción en lote
+// Qué sucede: Se crean listas desde un vector, una initializer_list y un flujo de entrada.
+// Por qué sucede: agregarRango reserva y registra los nodos por lotes; con iteradores de una sola pasada
+// copia antes los valores a un búfer.
+// Qué deberíamos esperar: Los valores en orden, enlazados en ambos sentidos, con un registro por nodo, y el GC
+// libera todos los nodos al destruir la lista.
+TEST(ListaDobleTest, AgregarRangoTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    std::vector<int> valores(1000);
+    std::iota(valores.begin(), valores.end(), 0);
+    gc.runGC();  // Parte de un registro sin basura de otras pruebas.
+    EstadisticasGC antes = gc.stats();
+    {
+        ListaDoble<int> lista(valores.begin(), valores.end());
+        EXPECT_EQ(gc.stats().asignacionesTotales, antes.asignacionesTotales + valores.size());
+        EXPECT_TRUE(std::equal(lista.begin(), lista.end(), valores.begin(), valores.end()));
+        EXPECT_TRUE(std::equal(lista.rbegin(), lista.rend(), valores.rbegin(), valores.rend()));
+        EXPECT_EQ(lista.obtenerHead()->anterior, nullptr);
+        EXPECT_EQ(lista.obtenerTail()->siguiente, nullptr);
+
+        lista.agregarRango(valores.begin(), valores.begin() + 3);  // Se engancha detrás del tail anterior.
+        EXPECT_EQ(lista.obtenerTail()->data, 2);
+        EXPECT_EQ(lista.obtenerTail()->anterior->anterior->anterior->data, 999);
+    }
+    EXPECT_EQ(gc.runGC().objetosLiberados, valores.size() + 3);  // Los nodos forman ciclos siguiente/anterior.
+    EXPECT_EQ(gc.stats().objetosVivos, antes.objetosVivos);
+
+    ListaDoble<int> corta{3, 1, 2};
+    std::istringstream flujo("4 5 6");
+    corta.agregarRango(std::istream_iterator<int>(flujo), std::istream_iterator<int>());
+    std::vector<int> esperado{3, 1, 2, 4, 5, 6};
+    EXPECT_TRUE(std::equal(corta.begin(), corta.end(), esperado.begin(), esperado.end()));
+}
+
+// Prueba de agregarRango y emplazar con nodos intrusivos y valores no triviales
+// Qué sucede: Se agregan cadenas por lote y una construida en el lugar.
+// Por qué sucede: Con PoliticaIntrusiva los nodos salen de la arena del tipo, no de la de la lista.
+// Qué deberíamos esperar: Los valores en orden; emplazar devuelve el valor del nuevo tail.
+TEST(ListaDobleTest, AgregarRangoIntrusivoTest) {
+    std::vector<std::string> palabras;
+    for (int i = 0; i < 300; i++) {
+        palabras.push_back("palabra " + std::to_string(i));
+    }
+    ListaDoble<std::string, PoliticaIntrusiva> lista(palabras.begin(), palabras.end());
+    std::string& ultima = lista.emplazar(3, 'x');
+    EXPECT_EQ(ultima, "xxx");
+    EXPECT_EQ(&ultima, &lista.obtenerTail()->data);
+    palabras.push_back("xxx");
+    EXPECT_TRUE(std::equal(lista.begin(), lista.end(), palabras.begin(), palabras.end()));
+}
+
+// Prueba de RadixSort con claves con signo, sin signo y flotantes
+// Qué sucede: Se ordenan listas de int, uint64_t y double con valores negativos, extremos y repetidos.
+// Por qué sucede: RadixSort codifica cada clave como un entero sin signo que conserve el orden.
+// Qué deberíamos esperar: El mismo resultado que quickSort (y std::sort) sobre los mismos valores.
+TEST(ListaDobleTest, RadixSortTest) {
+    std::mt19937_64 generador(3);
+    std::vector<int> enteros{std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 0, -1, 1};
+    std::vector<std::uint64_t> grandes{std::numeric_limits<std::uint64_t>::max(), 0, 1u << 31};
+    std::vector<double> flotantes{-0.0, 0.0, -std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<double>::infinity(), std::numeric_limits<double>::denorm_min(),
+                                  -std::numeric_limits<double>::max(), 1e-300};
+    std::uniform_real_distribution<double> distribucion(-1e9, 1e9);
+    for (int i = 0; i < 20000; i++) {
+        enteros.push_back(static_cast<int>(generador()) % 50000);
+        grandes.push_back(generador());
+        flotantes.push_back(distribucion(generador));
+    }
+
+    ListaDoble<int> listaEnteros(enteros.begin(), enteros.end());
+    ListaDoble<int> conQuickSort(enteros.begin(), enteros.end());
+    listaEnteros.ordenar();
+    quickSort(conQuickSort.obtenerHead(), conQuickSort.obtenerTail());
+    EXPECT_TRUE(std::equal(listaEnteros.begin(), listaEnteros.end(), conQuickSort.begin(), conQuickSort.end()));
+    EXPECT_EQ(listaEnteros.obtenerHead()->data, std::numeric_limits<int>::min());
+
+    ListaDoble<std::uint64_t, PoliticaIntrusiva> listaGrandes(grandes.begin(), grandes.end());
+    listaGrandes.ordenar();
+    std::sort(grandes.begin(), grandes.end());
+    EXPECT_TRUE(std::equal(listaGrandes.begin(), listaGrandes.end(), grandes.begin(), grandes.end()));
+
+    ListaDoble<double> listaFlotantes(flotantes.begin(), flotantes.end());
+    listaFlotantes.ordenar();
+    std::sort(flotantes.begin(), flotantes.end());
+    EXPECT_TRUE(std::equal(listaFlotantes.begin(), listaFlotantes.end(), flotantes.begin(), flotantes.end()));
+    EXPECT_TRUE(std::is_sorted(listaFlotantes.begin(), listaFlotantes.end()));
+}
+
+// Prueba de RadixSort con tipos sin clave aritmética y con ListaDesenrollada
+// Qué sucede: Se ordena una lista de cadenas (que usa mergeSort) y una ListaDesenrollada de chars.
+// Por qué sucede: radixSort elige el algoritmo al compilar según T.
+// Qué deberíamos esperar: Las dos listas ordenadas; la de cadenas con `tail` en el mayor.
+TEST(ListaDobleTest, RadixSortRespaldoTest) {
+    ListaDoble<std::string> palabras{"pera", "banana", "manzana", "kiwi"};
+    palabras.ordenar();
+    std::vector<std::string> esperado{"banana", "kiwi", "manzana", "pera"};
+    EXPECT_TRUE(std::equal(palabras.begin(), palabras.end(), esperado.begin(), esperado.end()));
+    EXPECT_EQ(palabras.obtenerTail()->data, "pera");
+
+    ListaDesenrollada<signed char> letras;
+    std::vector<signed char> valores;
+    for (int i = 0; i < 1000; i++) {
+        valores.push_back(static_cast<signed char>((i * 37) % 256 - 128));
+        letras.agregar(valores.back());
+    }
+    radixSort(letras);
+    std::sort(valores.begin(), valores.end());
+    EXPECT_TRUE(std::equal(letras.begin(), letras.end(), valores.begin(), valores.end()));
+}
+
+// Prueba del acceso por posición con el índice
+// Qué sucede: Se consultan posiciones de una lista creada por lote y se agregan valores con el índice ya construido.
+// Por qué sucede: El índice se construye la primera vez que se lo usa y `agregar` lo actualiza.
+// Qué deberíamos esperar: at(k) devuelve el k-ésimo valor, también los agregados después, y fuera de
+// rango lanza std::out_of_range.
+TEST(ListaDobleTest, IndiceAccesoTest) {
+    std::vector<int> valores(5000);
+    std::iota(valores.begin(), valores.end(), 0);
+    ListaDoble<int> lista(valores.begin(), valores.end());
+    EXPECT_EQ(lista.tamano(), valores.size());
+    for (std::size_t k : {std::size_t(0), std::size_t(1), std::size_t(3), std::size_t(4), std::size_t(1023),
+                          std::size_t(1024), std::size_t(4999)}) {
+        EXPECT_EQ(lista.at(k), valores[k]);
+    }
+    lista.at(10) = -10;
+    EXPECT_EQ(*std::next(lista.begin(), 10), -10);
+
+    for (int i = 5000; i < 6000; i++) {
+        lista.agregar(i);
+    }
+    EXPECT_EQ(lista.tamano(), 6000u);
+    EXPECT_EQ(lista.at(5999), 5999);
+    EXPECT_EQ(lista.at(5000), 5000);
+    EXPECT_THROW(lista.at(6000), std::out_of_range);
+
+    ListaDoble<int> vacia;
+    EXPECT_EQ(vacia.tamano(), 0u);
+    EXPECT_THROW(vacia.at(0), std::out_of_range);
+}
+
+// Prueba de inserciones y eliminaciones por posición
+// Qué sucede: Se aplican miles de inserciones y eliminaciones al azar a una lista y a un std::vector.
+// Por qué sucede: Cada operación corrige los anchos del índice y sube el nodo nuevo a niveles al azar.
+// Qué deberíamos esperar: La lista y el vector coinciden en cada paso, en los dos sentidos de recorrido,
+// y los nodos eliminados se liberan sin el GC.
+TEST(ListaDobleTest, IndiceInsertarEliminarTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    EstadisticasGC antes = gc.stats();
+    std::mt19937 generador(21);
+    std::vector<int> esperado{1, 2, 3};
+    {
+        ListaDoble<int, PoliticaIntrusiva> lista(esperado.begin(), esperado.end());
+        for (int paso = 0; paso < 4000; paso++) {
+            if (generador() % 3 != 0 || esperado.empty()) {
+                std::size_t posicion = generador() % (esperado.size() + 1);
+                lista.insertarEn(posicion, paso);
+                esperado.insert(esperado.begin() + static_cast<std::ptrdiff_t>(posicion), paso);
+            } else {
+                std::size_t posicion = generador() % esperado.size();
+                EXPECT_EQ(lista.eliminarEn(posicion), esperado[posicion]);
+                esperado.erase(esperado.begin() + static_cast<std::ptrdiff_t>(posicion));
+            }
+            std::size_t consulta = generador() % esperado.size();
+            ASSERT_EQ(lista.at(consulta), esperado[consulta]);
+        }
+        EXPECT_EQ(lista.tamano(), esperado.size());
+        EXPECT_TRUE(std::equal(lista.begin(), lista.end(), esperado.begin(), esperado.end()));
+        EXPECT_TRUE(std::equal(lista.rbegin(), lista.rend(), esperado.rbegin(), esperado.rend()));
+        EXPECT_EQ(lista.obtenerHead()->data, esperado.front());
+        EXPECT_EQ(lista.obtenerTail()->data, esperado.back());
+        EXPECT_EQ(gc.stats().objetosVivos, antes.objetosVivos + esperado.size());
+        EXPECT_THROW(lista.insertarEn(esperado.size() + 1, 0), std::out_of_range);
+        EXPECT_THROW(lista.eliminarEn(esperado.size()), std::out_of_range);
+
+        while (lista.tamano() > 0) {
+            lista.eliminarEn(0);
+        }
+        EXPECT_EQ(lista.obtenerHead(), nullptr);
+        EXPECT_EQ(lista.obtenerTail(), nullptr);
+    }
+    EXPECT_EQ(gc.stats().objetosVivos, antes.objetosVivos);
+}
+
+// Prueba del índice en copias que comparten nodos
+// Qué sucede: Se construye el índice de una lista, se la copia y se elimina un valor a través de la copia.
+// Por qué sucede: La copia comparte la cadena pero no el índice; la original debe descartar el suyo.
+// Qué deberíamos esperar: La copia empieza sin índice y ve la cadena tal como está; después de
+// invalidarIndice(), la original también ve el valor eliminado en `at` y `tamano`.
+TEST(ListaDobleTest, IndiceCopiasTest) {
+    ListaDoble<int> a{0, 1, 2, 3, 4, 5, 6, 7};
+    EXPECT_EQ(a.tamano(), 8u);
+    ListaDoble<int> b = a;
+    EXPECT_EQ(b.eliminarEn(3), 3);
+    EXPECT_EQ(b.tamano(), 7u);
+
+    a.invalidarIndice();
+    EXPECT_EQ(a.tamano(), 7u);
+    EXPECT_EQ(a.at(3), 4);
+    EXPECT_EQ(a.at(6), 7);
+    EXPECT_THROW(a.at(7), std::out_of_range);
+
+    ListaDoble<int> c;
+    c.agregar(42);
+    EXPECT_EQ(c.tamano(), 1u);
+    c = a;  // La asignación tampoco trae el índice de `a`.
+    EXPECT_EQ(a.eliminarEn(2), 2);
+    c.invalidarIndice();
+    EXPECT_EQ(c.tamano(), 6u);
+    EXPECT_EQ(c.at(2), 4);
+    EXPECT_EQ(c.at(5), 7);
+}
+
+// Prueba del índice cuando otra copia cambia la cadena
+// Qué sucede: Dos copias construyen su índice y después cada una inserta, quita u ordena a través de
+// la cadena compartida, sin llamar a invalidarIndice().
+// Por qué sucede: La versión compartida de la cadena avisa a la otra copia que su índice quedó viejo.
+// Qué deberíamos esperar: Cada copia reconstruye su índice y ve la cantidad nueva, también como const.
+TEST(ListaDobleTest, IndiceCopiaModificadaTest) {
+    ListaDoble<int> a{0, 1, 2, 3, 4, 5, 6, 7};
+    ListaDoble<int> b = a;
+    EXPECT_EQ(a.at(5), 5);  // Las dos copias construyen su índice.
+    EXPECT_EQ(b.at(5), 5);
+
+    EXPECT_EQ(b.eliminarEn(3), 3);
+    const ListaDoble<int>& constante = a;
+    EXPECT_EQ(constante.tamano(), 7u);
+    EXPECT_EQ(a.at(3), 4);
+    EXPECT_EQ(a.at(6), 7);
+    EXPECT_THROW(a.at(7), std::out_of_range);
+
+    a.insertarEn(2, 42);
+    EXPECT_EQ(b.tamano(), 8u);
+    EXPECT_EQ(b.at(2), 42);
+    EXPECT_EQ(b.at(7), 7);
+
+    b.ordenar();
+    EXPECT_EQ(a.at(7), 42);
+    EXPECT_EQ(*a.lower_bound(5), 5);
+    EXPECT_EQ(a.eliminarEn(1), 1);
+    EXPECT_EQ(b.tamano(), 7u);
+    EXPECT_EQ(b.at(1), 2);
+    EXPECT_EQ(b.at(6), 42);
+}
+
+// Prueba del índice en una lista movida
+// Qué sucede: Se construye el índice, se mueve la lista y se sigue usando la original.
+// Por qué sucede: El movimiento se lleva los nodos y el índice; la original queda vacía.
+// Qué deberíamos esperar: La original vuelve a armar su índice desde cero y la nueva conserva el suyo.
+TEST(ListaDobleTest, IndiceMovidaTest) {
+    ListaDoble<int> a;
+    a.agregar(1);
+    a.agregar(2);
+    EXPECT_EQ(a.at(0), 1);  // Construye el índice.
+    ListaDoble<int> b(std::move(a));
+    a.agregar(3);
+    a.agregar(4);
+    EXPECT_EQ(a.tamano(), 2u);
+    EXPECT_EQ(a.at(0), 3);
+    EXPECT_EQ(a.at(1), 4);
+    EXPECT_EQ(b.tamano(), 2u);
+    EXPECT_EQ(b.at(1), 2);
+
+    ListaDoble<int> c;
+    c = std::move(b);
+    b.agregar(5);
+    EXPECT_EQ(b.tamano(), 1u);
+    EXPECT_EQ(b.at(0), 5);
+    EXPECT_EQ(c.at(0), 1);
+}
+
+// Prueba de lower_bound en una lista ordenada
+// Qué sucede: Se ordena una lista con valores repetidos y se buscan valores presentes, ausentes y extremos.
+// Por qué sucede: Ordenar invalida el índice; la búsqueda lo reconstruye sobre el orden nuevo.
+// Qué deberíamos esperar: El mismo elemento que std::lower_bound sobre un vector ordenado.
+TEST(ListaDobleTest, IndiceLowerBoundTest) {
+    std::mt19937 generador(8);
+    std::vector<int> valores(20000);
+    for (int& valor : valores) {
+        valor = static_cast<int>(generador() % 5000) * 2;  // Solo pares: los impares no están.
+    }
+    ListaDoble<int> lista(valores.begin(), valores.end());
+    EXPECT_EQ(lista.at(0), valores[0]);  // Construye el índice antes de ordenar.
+    lista.ordenar();
+    std::sort(valores.begin(), valores.end());
+    for (int buscado : {-1, 0, 1, 2, 4999, 5000, 9998, 9999, 20000}) {
+        auto esperado = std::lower_bound(valores.begin(), valores.end(), buscado);
+        auto encontrado = lista.lower_bound(buscado);
+        if (esperado == valores.end()) {
+            EXPECT_EQ(encontrado, lista.end());
+        } else {
+            ASSERT_NE(encontrado, lista.end());
+            EXPECT_EQ(*encontrado, *esperado);
+            EXPECT_EQ(std::distance(lista.begin(), encontrado), esperado - valores.begin());
+        }
+    }
+
+    ListaDoble<std::string> palabras{"pera", "banana", "manzana", "kiwi"};
+    palabras.ordenarMerge();
+    EXPECT_EQ(*palabras.lower_bound("l"), "manzana");
+    EXPECT_EQ(*palabras.lower_bound("kiwi", std::less<std::string>()), "kiwi");
+}
+
+// Compara quickSortContiguo, con los dos núcleos de partición, contra quickSort sobre los mismos valores
+template <typename T>
+static void compararConQuickSort(const std::vector<T>& valores) {
+    ListaDoble<T> conQuickSort(valores.begin(), valores.end());
+    quickSort(conQuickSort.obtenerHead(), conQuickSort.obtenerTail());
+    for (NucleoParticion nucleo : {NucleoParticion::Automatico, NucleoParticion::Escalar}) {
+        ListaDoble<T> lista(valores.begin(), valores.end());
+        quickSortContiguo(lista.obtenerHead(), lista.obtenerTail(), nucleo);
+        EXPECT_TRUE(std::equal(lista.begin(), lista.end(), conQuickSort.begin(), conQuickSort.end()));
+    }
+}
+
+// Prueba de QuickSort contiguo con claves de 1, 4 y 8 bytes, con signo, sin signo y flotantes
+// Qué sucede: Se ordenan valores al azar con extremos, y entradas ordenadas, inversas y con pocos valores
+// distintos, de tamaños que no son múltiplos del ancho del vector.
+// Por qué sucede: La partición vectorial reparte de a 8 (o 4) claves y termina las sobrantes una por una;
+// las entradas con repetidos pasan por la partición de las iguales al pivote.
+// Qué deberíamos esperar: Exactamente el resultado de quickSort, con AVX2 (si el procesador lo tiene) y sin él.
+TEST(ListaDobleTest, QuickSortContiguoTest) {
+    std::mt19937_64 generador(13);
+    std::vector<int> enteros{std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 0, -1, 1};
+    std::vector<std::int64_t> largos{std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()};
+    std::vector<std::uint32_t> sinSigno{std::numeric_limits<std::uint32_t>::max(), 0, 1u << 31};
+    std::vector<double> flotantes{-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<double>::denorm_min(), -std::numeric_limits<double>::max(), 1e-300};
+    std::vector<unsigned char> bytes;
+    std::uniform_real_distribution<double> distribucion(-1e9, 1e9);
+    for (int i = 0; i < 5003; i++) {
+        enteros.push_back(static_cast<int>(generador()));
+        largos.push_back(static_cast<std::int64_t>(generador()) % 1000);  // Con muchos repetidos.
+        sinSigno.push_back(static_cast<std::uint32_t>(generador()));
+        flotantes.push_back(distribucion(generador));
+        bytes.push_back(static_cast<unsigned char>(generador()));
+    }
+    compararConQuickSort(enteros);
+    compararConQuickSort(largos);
+    compararConQuickSort(sinSigno);
+    compararConQuickSort(flotantes);
+    compararConQuickSort(bytes);
+
+    std::vector<int> ascendentes(3001);
+    std::iota(ascendentes.begin(), ascendentes.end(), -1500);
+    std::vector<int> descendentes(ascendentes.rbegin(), ascendentes.rend());
+    std::vector<int> dosValores(4097);
+    for (std::size_t i = 0; i < dosValores.size(); i++) {
+        dosValores[i] = (i * 7) % 3 == 0 ? 5 : -5;
+    }
+    compararConQuickSort(ascendentes);
+    compararConQuickSort(descendentes);
+    compararConQuickSort(dosValores);
+    compararConQuickSort(std::vector<float>(1000, 2.5f));
+}
+
+// Prueba de QuickSort contiguo con listas chicas y con un T sin clave aritmética
+// Qué sucede: Se ordenan listas de 0 a 40 enteros y una lista de cadenas.
+// Por qué sucede: Los tramos cortos no llegan a la partición vectorial, y las cadenas usan quickSort.
+// Qué deberíamos esperar: Todas ordenadas, con `head` y `tail` en los mismos nodos que antes.
+TEST(ListaDobleTest, QuickSortContiguoChicasTest) {
+    for (int n = 0; n <= 40; n++) {
+        std::vector<int> valores(n);
+        for (int i = 0; i < n; i++) {
+            valores[i] = (i * 17) % 11;
+        }
+        ListaDoble<int> lista(valores.begin(), valores.end());
+        const int* primero = n > 0 ? &lista.obtenerHead()->data : nullptr;
+        quickSortContiguo(lista.obtenerHead(), lista.obtenerTail());
+        std::sort(valores.begin(), valores.end());
+        EXPECT_TRUE(std::equal(lista.begin(), lista.end(), valores.begin(), valores.end()));
+        EXPECT_EQ(n > 0 ? &lista.obtenerHead()->data : nullptr, primero);
+    }
+
+    ListaDoble<std::string> palabras{"pera", "banana", "manzana", "kiwi"};
+    quickSortContiguo(palabras.obtenerHead(), palabras.obtenerTail());
+    std::vector<std::string> esperado{"banana", "kiwi", "manzana", "pera"};
+    EXPECT_TRUE(std::equal(palabras.begin(), palabras.end(), esperado.begin(), esperado.end()));
+}
+
+// Valor que cuenta sus instancias vivas, para ver cuándo se destruyen los nodos
+struct ValorContado {
+    static long vivos;
+    int valor;
+
+    ValorContado(int valor) : valor(valor) {
+        vivos++;
+    }
+
+    ValorContado(const ValorContado& otro) : valor(otro.valor) {
+        vivos++;
+    }
+
+    ~ValorContado() {
+        vivos--;
+    }
+};
+
+long ValorContado::vivos = 0;
+
+// Prueba de una lista larga con enlaces `anterior` débiles
+// Qué sucede: Se crea y se destruye una lista de un millón de nodos con PoliticaAnteriorDebil.
+// Por qué sucede: Sin ciclos fuertes, los nodos se liberan por conteo de referencias, y la lista los
+// suelta de a uno desde la cabeza en lugar de encadenar un destructor dentro de otro.
+// Qué deberíamos esperar: Todos los nodos destruidos al salir del bloque, sin desbordar la pila y
+// sin pasar por el GC.
+TEST(ListaDobleTest, AnteriorDebilLiberaSinGCTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    gc.runGC();
+    std::size_t inicial = gc.size();
+    {
+        ListaDoble<ValorContado, PoliticaAnteriorDebil> lista;
+        for (int i = 0; i < 1000000; i++) {
+            lista.emplazar(i);
+        }
+        EXPECT_EQ(ValorContado::vivos, 1000000);
+        EXPECT_EQ(gc.size(), inicial);
+    }
+    EXPECT_EQ(ValorContado::vivos, 0);
+    EXPECT_EQ(gc.size(), inicial);
+}
+
+// Prueba de las operaciones de ListaDoble con enlaces `anterior` débiles
+// Qué sucede: Se recorre al revés, se inserta y elimina (también la cola), se ordena con cada
+// algoritmo y se copia una lista que después se destruye.
+// Por qué sucede: Los algoritmos leen y reescriben `anterior` igual que con enlaces fuertes.
+// Qué deberíamos esperar: Los mismos resultados que con la política por defecto, y nodos compartidos
+// con la copia que siguen vivos mientras ella los referencie.
+TEST(ListaDobleTest, AnteriorDebilOperacionesTest) {
+    using Lista = ListaDoble<int, PoliticaAnteriorDebil>;
+    std::vector<int> valores{5, 3, 9, 1, 7, 3, 8};
+    Lista lista(valores.begin(), valores.end());
+    EXPECT_TRUE(std::equal(lista.rbegin(), lista.rend(), valores.rbegin(), valores.rend()));
+
+    lista.insertarEn(0, 4);
+    lista.insertarEn(lista.tamano(), 6);
+    EXPECT_EQ(lista.eliminarEn(lista.tamano() - 1), 6);
+    EXPECT_EQ(lista.eliminarEn(0), 4);
+    EXPECT_EQ(lista.obtenerTail()->data, 8);
+    EXPECT_EQ(lista.at(3), 1);
+
+    Lista copia;
+    copia = lista;
+    lista.ordenarMerge();
+    std::vector<int> ordenados = valores;
+    std::sort(ordenados.begin(), ordenados.end());
+    EXPECT_TRUE(std::equal(lista.begin(), lista.end(), ordenados.begin(), ordenados.end()));
+    EXPECT_TRUE(std::equal(lista.rbegin(), lista.rend(), ordenados.rbegin(), ordenados.rend()));
+    lista = Lista();
+    EXPECT_EQ(copia.obtenerHead()->data, 5);  // La copia comparte nodos y los mantiene vivos.
+
+    Lista porOrdenar(valores.begin(), valores.end());
+    porOrdenar.ordenar();
+    EXPECT_TRUE(std::equal(porOrdenar.rbegin(), porOrdenar.rend(), ordenados.rbegin(), ordenados.rend()));
+    Lista porQuickSort(valores.begin(), valores.end());
+    quickSort(porQuickSort.obtenerHead(), porQuickSort.obtenerTail());
+    EXPECT_TRUE(std::equal(porQuickSort.begin(), porQuickSort.end(), ordenados.begin(), ordenados.end()));
+    EXPECT_TRUE(std::equal(porQuickSort.rbegin(), porQuickSort.rend(), ordenados.rbegin(), ordenados.rend()));
+
+    // Una referencia externa a un nodo del medio mantiene viva la cadena que sigue, pero no la anterior.
+    using NodoDebil = Nodo<int, PoliticaAnteriorDebil>;
+    using Vista = VistaNodo<int, PoliticaAnteriorDebil>;
+    MPointer<NodoDebil, PoliticaAnteriorDebil> medio(Vista(porQuickSort.obtenerHead()->siguiente));
+    MWeakPointer<NodoDebil, PoliticaAnteriorDebil> primero = porQuickSort.obtenerHead();
+    porQuickSort = Lista();
+    EXPECT_TRUE(primero.expired());
+    EXPECT_EQ(medio->data, ordenados[1]);
+    EXPECT_EQ(Vista(medio->siguiente)->data, ordenados[2]);
+    EXPECT_TRUE(medio->anterior.expired());
+}
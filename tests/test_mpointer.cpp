@@ -1,4 +1,9 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 #include "MPointer.h"
 
 // Prueba para verificar la asignación de un valor a MPointer
@@ -101,6 +106,357 @@ TEST(MPointerTest, GetIdTest) {
     EXPECT_EQ(myPtr.getId(), myPtr2.getId());  // Después de la asignación, ambos deben tener el mismo ID.
 }
 
+// Prueba para verificar la construcción en el lugar con New
+// Qué sucede: Se crea un MPointer pasando argumentos a New y otro adoptando un objeto creado con new.
+// Por qué sucede: Esta prueba verifica que ambos caminos de reserva construyan y registren el objeto.
+// Qué deberíamos esperar: Los valores coinciden y ambos objetos quedan registrados en el GC.
+TEST(MPointerTest, NewWithArgumentsTest) {
+    MPointer<std::string> texto = MPointer<std::string>::New(3, 'x');  // Construye std::string(3, 'x').
+    EXPECT_EQ(*texto, "xxx");
+    EXPECT_TRUE(MPointerGC::getInstance().isRegistered(texto.getId()));
+
+    MPointer<int> adoptado(new int(7));  // Adopta un entero reservado por separado.
+    EXPECT_EQ(*adoptado, 7);
+    EXPECT_TRUE(MPointerGC::getInstance().isRegistered(adoptado.getId()));
+}
+
+// Prueba para verificar que New reserva una sola vez
+// Qué sucede: Se cuenta cuántos objetos quedan registrados tras crear varios MPointer y copiarlos.
+// Por qué sucede: Esta prueba asegura que las copias comparten el bloque y no se registran de nuevo.
+// Qué deberíamos esperar: Solo los objetos nuevos aumentan la cantidad de registros.
+TEST(MPointerTest, CopiesShareControlBlockTest) {
+    std::size_t inicial = MPointerGC::getInstance().size();
+    MPointer<int> a = MPointer<int>::New(1);
+    MPointer<int> b = a;
+    MPointer<int> c = MPointer<int>::New(2);
+    c = b;
+    EXPECT_EQ(MPointerGC::getInstance().size(), inicial + 1);  // El objeto de `c` se liberó al reasignarlo.
+    EXPECT_EQ(&a, &c);
+}
+
+// Prueba para verificar el constructor y la asignación por movimiento
+// Qué sucede: Se mueve un MPointer a otro y luego se asigna por movimiento sobre un tercero.
+// Por qué sucede: Esta prueba verifica que mover transfiere la propiedad sin tocar el contador.
+// Qué deberíamos esperar: El origen queda nulo y el contador sigue en 1.
+TEST(MPointerTest, MoveSemanticsTest) {
+    MPointer<int> origen = MPointer<int>::New(5);
+    MPointer<int> destino(std::move(origen));
+    EXPECT_TRUE(origen == nullptr);  // El origen queda vacío.
+    EXPECT_EQ(*destino, 5);
+    EXPECT_EQ(destino.useCount(), 1);  // Mover no incrementa el contador.
+
+    MPointer<int> otro = MPointer<int>::New(6);
+    MPointerGC::Handle idOtro = otro.getId();
+    otro = std::move(destino);  // Libera el 6 y toma el 5.
+    EXPECT_FALSE(MPointerGC::getInstance().isRegistered(idOtro));
+    EXPECT_EQ(*otro, 5);
+    EXPECT_EQ(otro.useCount(), 1);
+
+    otro = nullptr;  // Soltar asignando nullptr libera el objeto.
+    EXPECT_TRUE(otro == nullptr);
+    EXPECT_EQ(otro.useCount(), 0);
+}
+
+// Prueba para verificar que las vistas no modifican el contador
+// Qué sucede: Se crean vistas de un MPointer, se copian y se vuelven a convertir en MPointer.
+// Por qué sucede: Esta prueba asegura que los recorridos con vistas no generan tráfico en el contador.
+// Qué deberíamos esperar: El contador solo cambia al crear un MPointer a partir de la vista.
+TEST(MPointerTest, VistaDoesNotCountTest) {
+    MPointer<int> propietario = MPointer<int>::New(9);
+    MPointerVista<int> vista = propietario;
+    MPointerVista<int> copia = vista;
+    EXPECT_EQ(propietario.useCount(), 1);  // Las vistas no cuentan.
+    EXPECT_EQ(*copia, 9);
+    EXPECT_TRUE(copia == vista);
+
+    MPointer<int> otroPropietario(copia);  // Volver a un MPointer sí cuenta.
+    EXPECT_EQ(propietario.useCount(), 2);
+
+    MPointerVista<int> nula;
+    EXPECT_TRUE(nula == nullptr);
+}
+
+// Prueba para verificar que los punteros nulos no reservan ni registran memoria
+// Qué sucede: Se crea un MPointer nulo y se copia.
+// Por qué sucede: Esta prueba asegura que los enlaces vacíos de cada Nodo no cuestan reservas.
+// Qué deberíamos esperar: La cantidad de registros en el GC no cambia y el contador es 0.
+TEST(MPointerTest, NullConstructionIsFreeTest) {
+    std::size_t inicial = MPointerGC::getInstance().size();
+    MPointer<int> nulo(nullptr);
+    MPointer<int> copiaNula = nulo;
+    EXPECT_EQ(MPointerGC::getInstance().size(), inicial);  // Los nulos no se registran.
+    EXPECT_EQ(copiaNula.useCount(), 0);
+}
+
+// Prueba para verificar que los handles del Garbage Collector son estables
+// Qué sucede: Se registran dos punteros, se elimina uno y se registra otro que reutiliza su ranura.
+// Por qué sucede: Esta prueba asegura que un handle vencido no se confunda con el nuevo ocupante de la ranura.
+// Qué deberíamos esperar: El handle viejo deja de ser válido y el nuevo es distinto de todos los anteriores.
+TEST(MPointerGCTest, HandleReuseTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    BloqueControl* a = BloqueEnLinea<int>::crear(1);
+    BloqueControl* b = BloqueEnLinea<int>::crear(2);
+    BloqueControl* c = BloqueEnLinea<int>::crear(3);
+    std::size_t inicial = gc.size();
+
+    MPointerGC::Handle idA = gc.registerPointer(a);
+    MPointerGC::Handle idB = gc.registerPointer(b);
+    EXPECT_NE(idA, idB);  // Cada registro recibe su propio handle.
+    EXPECT_EQ(gc.size(), inicial + 2);
+
+    gc.deregisterPointer(idA);
+    EXPECT_FALSE(gc.isRegistered(idA));  // El handle eliminado queda vencido.
+    EXPECT_EQ(gc.getPointer(idB), b);  // La entrada movida sigue accesible por su handle.
+
+    MPointerGC::Handle idC = gc.registerPointer(c);
+    EXPECT_NE(idC, idA);  // La ranura reutilizada entrega un handle nuevo.
+    EXPECT_EQ(gc.getPointer(idA), nullptr);
+    EXPECT_EQ(gc.getPointer(idC), c);
+
+    gc.deregisterPointer(idA);  // Eliminar un handle vencido no afecta a nadie.
+    EXPECT_TRUE(gc.isRegistered(idC));
+
+    gc.deregisterPointer(idB);
+    gc.deregisterPointer(idC);
+    EXPECT_EQ(gc.size(), inicial);
+    a->destruir();
+    b->destruir();
+    c->destruir();
+}
+
+// Prueba para verificar que el objeto se elimina del GC cuando muere la última referencia
+// Qué sucede: Se crea un MPointer, se copia y se destruyen ambas copias.
+// Por qué sucede: Esta prueba asegura que el registro se libera una sola vez y con el handle compartido.
+// Qué deberíamos esperar: El handle sigue registrado mientras quede una copia y deja de estarlo al final.
+TEST(MPointerGCTest, DeregisterOnLastReferenceTest) {
+    MPointerGC::Handle id;
+    {
+        MPointer<int> original = MPointer<int>::New();
+        id = original.getId();
+        {
+            MPointer<int> copia = original;
+            EXPECT_TRUE(MPointerGC::getInstance().isRegistered(id));
+        }
+        EXPECT_TRUE(MPointerGC::getInstance().isRegistered(id));  // Aún queda `original`.
+    }
+    EXPECT_FALSE(MPointerGC::getInstance().isRegistered(id));  // Ya no quedan referencias.
+}
+
+// Prueba para verificar la reserva en arenas
+// Qué sucede: Se crean MPointers en una arena propia, con `new` global y en una arena de otro tamaño.
+// Por qué sucede: La arena reutiliza los bloques liberados; una arena que no sirve para T se ignora.
+// Qué deberíamos esperar: Un bloque liberado se vuelve a entregar, y todos los caminos guardan el valor.
+TEST(MPointerTest, NewEnArenaTest) {
+    ArenaDe<std::string> arena;
+    MPointer<std::string> primero = MPointer<std::string>::NewEn(&arena, "uno");
+    std::string* direccion = &primero;
+    primero = nullptr;
+    MPointer<std::string> segundo = MPointer<std::string>::NewEn(&arena, "dos");
+    EXPECT_EQ(&segundo, direccion);  // Reutiliza el bloque recién liberado.
+    EXPECT_EQ(*segundo, "dos");
+
+    MPointer<std::string> global = MPointer<std::string>::NewEn(nullptr, "tres");
+    EXPECT_EQ(*global, "tres");
+
+    ArenaDe<char> chica;  // Bloques demasiado pequeños para un std::string.
+    MPointer<std::string> ignorada = MPointer<std::string>::NewEn(&chica, "cuatro");
+    EXPECT_EQ(*ignorada, "cuatro");
+}
+
+// Prueba para verificar los contadores del GC
+// Qué sucede: Se crean y destruyen MPointers y se comparan las estadísticas antes y después.
+// Por qué sucede: Cada registro y eliminación suma en los contadores del fragmento.
+// Qué deberíamos esperar: Asignaciones, liberaciones, objetos y bytes vivos cambian en lo justo.
+TEST(MPointerGCTest, StatsTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    EstadisticasGC antes = gc.stats();
+    {
+        MPointer<int> a = MPointer<int>::New(1);
+        MPointer<int> b = MPointer<int>::New(2);
+        EstadisticasGC durante = gc.stats();
+        EXPECT_EQ(durante.asignacionesTotales, antes.asignacionesTotales + 2);
+        EXPECT_EQ(durante.objetosVivos, antes.objetosVivos + 2);
+        EXPECT_EQ(durante.bytesVivos, antes.bytesVivos + 2 * sizeof(BloqueEnLinea<int>));
+        EXPECT_GE(durante.picoBytesVivos, durante.bytesVivos);
+    }
+    EstadisticasGC despues = gc.stats();
+    EXPECT_EQ(despues.liberacionesTotales, antes.liberacionesTotales + 2);
+    EXPECT_EQ(despues.objetosVivos, antes.objetosVivos);
+    EXPECT_EQ(despues.bytesVivos, antes.bytesVivos);
+}
+
+// Prueba para verificar el trazador
+// Qué sucede: Con NivelRegistroGC::Detalle se crea un MPointer y se vuelca la traza.
+// Por qué sucede: En ese nivel cada registro y eliminación se guarda en el búfer circular.
+// Qué deberíamos esperar: Aparecen ambos eventos; en el nivel por defecto no se agrega nada.
+TEST(MPointerGCTest, TraceTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    std::ostringstream descarte;
+    gc.dumpTrace(descarte);  // Descarta eventos de otras pruebas.
+
+    gc.setLogLevel(NivelRegistroGC::Detalle);
+    MPointerGC::Handle id;
+    {
+        MPointer<int> ptr = MPointer<int>::New(5);
+        id = ptr.getId();
+    }
+    gc.setLogLevel(NivelRegistroGC::Silencio);
+
+    std::ostringstream traza;
+    EXPECT_EQ(gc.dumpTrace(traza), 2u);
+    EXPECT_NE(traza.str().find("registro " + std::to_string(id)), std::string::npos);
+    EXPECT_NE(traza.str().find("eliminacion " + std::to_string(id)), std::string::npos);
+
+    { MPointer<int> silencioso = MPointer<int>::New(6); }
+    std::ostringstream vacia;
+    EXPECT_EQ(gc.dumpTrace(vacia), 0u);
+}
+
+// Prueba para verificar la política sin GC
+// Qué sucede: Se crean y copian MPointers con PoliticaLocal.
+// Por qué sucede: Esta política no registra los objetos; solo cuenta referencias.
+// Qué deberíamos esperar: El registro no cambia, el handle es inválido y el objeto muere con su última referencia.
+TEST(MPointerTest, PoliticaLocalTest) {
+    MPointerGC& gc = MPointerGC::getInstance();
+    EstadisticasGC antes = gc.stats();
+    {
+        MPointer<std::string, PoliticaLocal> a = MPointer<std::string, PoliticaLocal>::New("local");
+        MPointer<std::string, PoliticaLocal> b = a;
+        EXPECT_EQ(a.getId(), MPointerGC::HANDLE_INVALIDO);
+        EXPECT_EQ(b.useCount(), 2);
+        EXPECT_EQ(*b, "local");
+        EXPECT_EQ(gc.stats().asignacionesTotales, antes.asignacionesTotales);
+    }
+    EXPECT_EQ(gc.stats().liberacionesTotales, antes.liberacionesTotales);
+}
+
+// Objeto con su propio contador, para las pruebas de la política intrusiva
+struct Intrusivo : ObjetoIntrusivo {
+    static int vivos;
+    int valor;
+
+    explicit Intrusivo(int valor) : valor(valor) {
+        vivos++;
+    }
+
+    Intrusivo(const Intrusivo& otro) : ObjetoIntrusivo(otro), valor(otro.valor) {
+        vivos++;
+    }
+
+    ~Intrusivo() {
+        vivos--;
+    }
+};
+
+int Intrusivo::vivos = 0;
+
+// Prueba para verificar la política intrusiva
+// Qué sucede: Se crea un objeto intrusivo, se copia el MPointer y se copia el objeto.
+// Por qué sucede: El contador vive en el objeto, así que el MPointer guarda un solo puntero.
+// Qué deberíamos esperar: Ocupa lo mismo que un puntero crudo, la copia del objeto empieza sin
+// referencias propias y el objeto se registra y se libera como cualquier otro.
+TEST(MPointerTest, PoliticaIntrusivaTest) {
+    static_assert(sizeof(MPointer<Intrusivo, PoliticaIntrusiva>) == sizeof(Intrusivo*), "Un solo puntero");
+    static_assert(sizeof(MPointer<int>) == 2 * sizeof(void*), "Objeto y bloque de control");
+
+    {
+        MPointer<Intrusivo, PoliticaIntrusiva> a = MPointer<Intrusivo, PoliticaIntrusiva>::New(7);
+        MPointer<Intrusivo, PoliticaIntrusiva> b = a;
+        EXPECT_EQ(a.useCount(), 2);
+        EXPECT_TRUE(MPointerGC::getInstance().isRegistered(a.getId()));
+        EXPECT_EQ(Intrusivo::vivos, 1);
+
+        MPointer<Intrusivo, PoliticaIntrusiva> copia = MPointer<Intrusivo, PoliticaIntrusiva>::New(*a);
+        EXPECT_EQ(copia->valor, 7);
+        EXPECT_EQ(copia.useCount(), 1);
+        EXPECT_NE(copia.getId(), a.getId());
+
+        MPointerVista<Intrusivo, PoliticaIntrusiva> vista = b;
+        b = nullptr;
+        EXPECT_EQ(vista->valor, 7);
+        EXPECT_EQ(Intrusivo::vivos, 2);
+    }
+    EXPECT_EQ(Intrusivo::vivos, 0);
+}
+
+// Objeto que cuenta sus instancias vivas, para las pruebas de referencias débiles
+struct Observado {
+    static int vivos;
+    int valor;
+
+    explicit Observado(int valor) : valor(valor) {
+        vivos++;
+    }
+
+    ~Observado() {
+        vivos--;
+    }
+};
+
+int Observado::vivos = 0;
+
+// Prueba para verificar MWeakPointer
+// Qué sucede: Se observa un objeto con una referencia débil, se lo bloquea y se suelta la última fuerte.
+// Por qué sucede: La referencia débil comparte el bloque de control sin sumar al contador.
+// Qué deberíamos esperar: lock() da una referencia fuerte mientras el objeto vive; al soltar la última
+// fuerte el objeto se destruye y se desregistra aunque queden débiles, que pasan a estar vencidas.
+TEST(MPointerTest, MWeakPointerTest) {
+    MWeakPointer<Observado> debil;
+    EXPECT_TRUE(debil.expired());
+    EXPECT_EQ(debil.lock(), nullptr);
+    MPointerGC::Handle id;
+    {
+        MPointer<Observado> fuerte = MPointer<Observado>::New(5);
+        id = fuerte.getId();
+        debil = fuerte;
+        MWeakPointer<Observado> copia = debil;
+        EXPECT_EQ(fuerte.useCount(), 1);
+        EXPECT_FALSE(copia.expired());
+
+        MPointer<Observado> bloqueado = debil.lock();
+        EXPECT_EQ(bloqueado->valor, 5);
+        EXPECT_EQ(bloqueado, fuerte);
+        EXPECT_EQ(debil.useCount(), 2);
+    }
+    EXPECT_EQ(Observado::vivos, 0);
+    EXPECT_FALSE(MPointerGC::getInstance().isRegistered(id));
+    EXPECT_TRUE(debil.expired());
+    EXPECT_NE(debil, nullptr);  // Sigue observando el bloque, aunque el objeto ya no exista.
+    EXPECT_EQ(debil.lock(), nullptr);
+    debil = nullptr;  // Suelta la última referencia al bloque, que recién ahora se libera.
+}
+
+// Prueba de MWeakPointer sin GC y entre hilos
+// Qué sucede: Con PoliticaCompartida, varios hilos bloquean la referencia débil mientras el hilo
+// principal suelta la última referencia fuerte.
+// Por qué sucede: lock() solo suma si el contador no llegó a 0, con un compare-exchange.
+// Qué deberíamos esperar: Cada lock() exitoso ve el objeto entero; el objeto se destruye una sola vez.
+TEST(MPointerTest, MWeakPointerHilosTest) {
+    for (int ronda = 0; ronda < 50; ronda++) {
+        MPointer<Observado, PoliticaCompartida> fuerte = MPointer<Observado, PoliticaCompartida>::New(ronda);
+        MWeakPointer<Observado, PoliticaCompartida> debil = fuerte;
+        std::vector<std::thread> hilos;
+        std::atomic<int> errores{0};
+        for (int h = 0; h < 4; h++) {
+            hilos.emplace_back([debil, ronda, &errores] {
+                for (int i = 0; i < 200; i++) {
+                    MPointer<Observado, PoliticaCompartida> bloqueado = debil.lock();
+                    if (bloqueado != nullptr && bloqueado->valor != ronda) {
+                        errores++;
+                    }
+                }
+            });
+        }
+        fuerte = nullptr;
+        for (std::thread& hilo : hilos) {
+            hilo.join();
+        }
+        EXPECT_EQ(errores.load(), 0);
+        EXPECT_TRUE(debil.expired());
+        EXPECT_EQ(Observado::vivos, 0);
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();  // Ejecuta todas las pruebas.
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include "OrdenamientoExterno.h"
+
+// Directorio temporal propio de una prueba, para comprobar que los tramos se borran
+static std::string crearDirectorio() {
+    std::string plantilla = ::testing::TempDir() + "orden_externo_XXXXXX";
+    return ::mkdtemp(&plantilla[0]) != nullptr ? plantilla : ::testing::TempDir();
+}
+
+static int archivosEn(const std::string& directorio) {
+    int cantidad = 0;
+    if (DIR* dir = ::opendir(directorio.c_str())) {
+        while (dirent* entrada = ::readdir(dir)) {
+            cantidad += entrada->d_name[0] != '.';
+        }
+        ::closedir(dir);
+    }
+    return cantidad;
+}
+
+static std::vector<int> valoresAleatorios(int cantidad) {
+    std::mt19937 generador(11);
+    std::vector<int> valores(cantidad);
+    for (int& valor : valores) {
+        valor = static_cast<int>(generador() % 1000) - 500;  // Con muchos repetidos.
+    }
+    return valores;
+}
+
+// Prueba de un ordenamiento que entra en memoria
+// Qué sucede: Se ordena una lista cuyos valores caben en un solo tramo.
+// Por qué sucede: Sin tramos de más no hace falta tocar el disco.
+// Qué deberíamos esperar: La lista de salida ordenada y ningún tramo volcado.
+TEST(OrdenamientoExternoTest, EnMemoriaTest) {
+    std::vector<int> valores = valoresAleatorios(5000);
+    ListaDoble<int> entrada(valores.begin(), valores.end());
+    ListaDoble<int> salida;
+    ResultadoOrdenExterno resultado = ordenarExterno(entrada.begin(), entrada.end(), salida);
+
+    std::sort(valores.begin(), valores.end());
+    EXPECT_TRUE(std::equal(salida.begin(), salida.end(), valores.begin(), valores.end()));
+    EXPECT_EQ(resultado.valores, valores.size());
+    EXPECT_EQ(resultado.tramos, 0u);
+    EXPECT_EQ(resultado.bytesEscritos, 0u);
+}
+
+// Prueba de un ordenamiento con tramos en disco y mezclas intermedias
+// Qué sucede: Con 4 KB de memoria y búferes de 512 bytes, 20000 enteros forman 20 tramos y cada
+// mezcla admite 8, así que hace falta mezclar por grupos antes de la mezcla final.
+// Por qué sucede: Es el camino de los datos más grandes que la memoria, en miniatura.
+// Qué deberíamos esperar: El orden del comparador (descendente) y ningún archivo temporal al final.
+TEST(OrdenamientoExternoTest, TramosEnDiscoTest) {
+    OpcionesOrdenExterno opciones;
+    opciones.bytesMemoria = 4096;
+    opciones.bytesBufer = 512;
+    opciones.directorioTemporal = crearDirectorio();
+    std::vector<int> valores = valoresAleatorios(20000);
+    ListaDoble<int, PoliticaIntrusiva> salida;
+    ResultadoOrdenExterno resultado = ordenarExterno(valores.begin(), valores.end(), salida, opciones, std::greater<int>());
+
+    std::sort(valores.begin(), valores.end(), std::greater<int>());
+    EXPECT_TRUE(std::equal(salida.begin(), salida.end(), valores.begin(), valores.end()));
+    EXPECT_EQ(resultado.tramos, 20u);
+    EXPECT_GT(resultado.pasadasMezcla, 0u);
+    EXPECT_GE(resultado.bytesLeidos, valores.size() * sizeof(int));
+    EXPECT_EQ(archivosEn(opciones.directorioTemporal), 0);
+    ::rmdir(opciones.directorioTemporal.c_str());
+}
+
+// Prueba de instantánea a instantánea
+// Qué sucede: Se ordena una instantánea de doubles hacia otra, con tramos en disco.
+// Por qué sucede: La entrada se lee por búfer y la salida se escribe igual: ninguna está entera en memoria.
+// Qué deberíamos esperar: La salida mapeada está ordenada, con los mismos valores, y se informa un rendimiento.
+TEST(OrdenamientoExternoTest, InstantaneaTest) {
+    OpcionesOrdenExterno opciones;
+    opciones.bytesMemoria = 64 * 1024;
+    opciones.bytesBufer = 4096;
+    opciones.directorioTemporal = crearDirectorio();
+    const std::string entrada = opciones.directorioTemporal + "/entrada";
+    const std::string salida = opciones.directorioTemporal + "/salida";
+    std::mt19937 generador(5);
+    std::uniform_real_distribution<double> distribucion(-1e6, 1e6);
+    std::vector<double> valores(100000);
+    for (double& valor : valores) {
+        valor = distribucion(generador);
+    }
+    guardarInstantanea(valores.data(), valores.data() + valores.size(), entrada);
+
+    ResultadoOrdenExterno resultado = ordenarInstantanea<double>(entrada, salida, opciones);
+    InstantaneaMapeada<double> ordenada(salida);
+    std::sort(valores.begin(), valores.end());
+    EXPECT_TRUE(std::equal(ordenada.begin(), ordenada.end(), valores.begin(), valores.end()));
+    EXPECT_EQ(resultado.tramos, 13u);  // 800000 bytes en tramos de 65536.
+    EXPECT_GT(resultado.megabytesPorSegundo(), 0.0);
+    EXPECT_EQ(archivosEn(opciones.directorioTemporal), 2);  // Solo la entrada y la salida.
+    std::remove(entrada.c_str());
+    std::remove(salida.c_str());
+    ::rmdir(opciones.directorioTemporal.c_str());
+}